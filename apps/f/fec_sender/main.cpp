@@ -48,10 +48,12 @@ int main(int argc, char** argv) {
     std::string msg = "ltfec hello";
     int N = 8;
     int K = 1;
+    int cols = 0;
     int payload_len_cli = -1;
     int fps = 30;
     int blocks = 1;
     int inter_block_ms = 0;
+    bool compact_header = false;
 
     po::options_description desc("Options");
     desc.add_options()
@@ -64,10 +66,12 @@ int main(int argc, char** argv) {
         ("msg", po::value<std::string>(&msg)->default_value(msg), "Payload text (used if --payload-len < 0)")
         ("payload-len", po::value<int>(&payload_len_cli)->default_value(-1), "Payload length in bytes; if <0, use --msg length")
         ("N", po::value<int>(&N)->default_value(8), "Data frames per block")
-        ("K", po::value<int>(&K)->default_value(1), "Parity frames per block (1=XOR, 2..4=GF(256))")
+        ("K", po::value<int>(&K)->default_value(1), "Parity frames per block (1=XOR, 2..4=GF(256), 5..32=Cauchy GF(256); N+K>256 or K>32 = Cauchy GF(2^16))")
+        ("cols", po::value<int>(&cols)->default_value(0), "2D row/column XOR with L columns (N = L*D; K is set to L + D); 0 = off")
         ("fps", po::value<int>(&fps)->default_value(30), "Pace data frames at FPS (>=1)")
         ("blocks", po::value<int>(&blocks)->default_value(1), "Number of blocks to send")
         ("inter-block-ms", po::value<int>(&inter_block_ms)->default_value(0), "Sleep between blocks (ms)")
+        ("compact-header", po::bool_switch(&compact_header), "Send v2 frames (8-byte header, payload length implied by the datagram size)")
         ;
 
     po::variables_map vm;
@@ -92,8 +96,15 @@ int main(int argc, char** argv) {
         std::cerr << "error: --dest is required\n\n" << desc << "\n";
         return 2;
     }
-    if (N <= 0 || N > 255 || K < 0 || K > 4) {
-        std::cerr << "error: invalid N/K (N:1..255, K:0..4)\n";
+    if (cols > 0) {
+        if (N <= 0 || N > 255 || cols > 255 || N % cols != 0) {
+            std::cerr << "error: --cols must divide N\n";
+            return 2;
+        }
+        K = cols + N / cols;
+    }
+    else if (N <= 0 || N > 65535 || K < 0 || K > 256 || N + K > 65536) {
+        std::cerr << "error: invalid N/K (N:1..65535, K:0..256, N+K<=65536)\n";
         return 2;
     }
     if (fps <= 0) fps = 30;
@@ -125,6 +136,22 @@ int main(int argc, char** argv) {
         mloop = (loop_opt != 0);
     }
 
+    TxConfig txc{ .N = static_cast<std::uint16_t>(N),
+                  .K = static_cast<std::uint16_t>(K),
+                  .max_payload_len = 1300,
+                  .fec_scheme_id = cols > 0 ? static_cast<std::uint8_t>(fec_scheme_id::xor_2d) : std::uint8_t{ 0 },
+                  .columns = static_cast<std::uint8_t>(cols),
+                  .wire_version = compact_header ? k_protocol_version_v2 : k_protocol_version };
+    TxBlockAssembler tx(txc, /*gen_seed*/ static_cast<std::uint32_t>(now_ms() & 0xFFFFFFFFu));
+    const std::size_t payload_len = (payload_len_cli >= 0) ? static_cast<std::size_t>(payload_len_cli)
+        : static_cast<std::size_t>(msg.size());
+    if (payload_len > tx.max_push_len()) {
+        // Streamed blocks keep room for the varlen length table (2N bytes) in every parity frame.
+        std::cerr << "error: payload of " << payload_len << " bytes exceeds the streamed limit of " << tx.max_push_len()
+                  << " bytes for N=" << N << "\n";
+        return 2;
+    }
+
     // ---- Metrics (standard schema) ----
     ltfec::metrics::CsvWriter m(1);
     const auto run_id = ltfec::util::uuid_v4();
@@ -154,62 +181,60 @@ int main(int argc, char** argv) {
     std::size_t total_sent_bytes = 0;
     std::uint32_t total_sent_frames = 0;
 
-    TxConfig txc{ .N = static_cast<std::uint16_t>(N),
-                  .K = static_cast<std::uint16_t>(K),
-                  .max_payload_len = 1300 };
-    TxBlockAssembler tx(txc, /*gen_seed*/ static_cast<std::uint32_t>(now_ms() & 0xFFFFFFFFu));
-
     for (int b = 0; b < blocks; ++b) {
-        // Build one block
-        const std::size_t payload_len = (payload_len_cli >= 0) ? static_cast<std::size_t>(payload_len_cli)
-            : static_cast<std::size_t>(msg.size());
-        std::vector<std::vector<std::byte>> data_bytes(N);
-        std::vector<std::span<const std::byte>> data_spans; data_spans.reserve(N);
-        for (int i = 0; i < N; ++i) {
-            data_bytes[i] = make_payload(msg, payload_len, static_cast<std::uint32_t>(b), static_cast<std::uint16_t>(i));
-            data_spans.emplace_back(data_bytes[i].data(), data_bytes[i].size());
-        }
+        // Stream one block: each data frame goes out as soon as its payload exists; parity is
+        // accumulated on the way and comes out together with the last data frame.
+        const std::uint32_t gen = tx.peek_next_gen();
+        std::size_t block_frames = 0;
+        std::vector<std::vector<std::byte>> parity;
+        TxDataFrameParts data_frame;
 
-        std::vector<std::vector<std::byte>> frames;
-        if (!tx.assemble_block(data_spans, frames)) {
-            std::cerr << "assemble_block failed (block " << b << ")\n";
-            break;
-        }
-        const std::uint32_t gen = tx.peek_next_gen() - 1;
-
-        // Send all frames in this block
-        for (size_t i = 0; i < frames.size(); ++i) {
-            std::size_t n = 0;
-            auto ec = sender.send(std::span<const std::byte>(frames[i].data(), frames[i].size()), n);
-            auto ts = now_ms();
-            total_sent_bytes += n;
-            ++total_sent_frames;
-
-            if (ec) {
-                std::cerr << "send error on frame " << i << " (block " << b << "): " << ec.message() << "\n";
-                m.add_row({
-                    std::to_string(ltfec::metrics::schema_version), run_id,
-                    std::to_string(ts), "sender", "send_error",
-                    dest_s, std::to_string(ep.port), std::to_string(n)
-                    });
-                m.finish_with_summary(std::string("error: ") + ec.message());
+        for (int i = 0; i < N; ++i) {
+            const auto payload = make_payload(msg, payload_len, static_cast<std::uint32_t>(b), static_cast<std::uint16_t>(i));
+            const auto pl = std::span<const std::byte>(payload.data(), payload.size());
+            if (!tx.push_data(pl, data_frame, parity)) {
+                std::cerr << "push_data failed (block " << b << ", frame " << i << ")\n";
                 goto finish;
             }
-            else {
-                m.add_row({
-                    std::to_string(ltfec::metrics::schema_version), run_id,
-                    std::to_string(ts), "sender", (i < static_cast<size_t>(N) ? "sent_data" : "sent_parity"),
-                    dest_s, std::to_string(ep.port), std::to_string(n)
-                    });
+
+            // Send the data frame straight from the payload buffer (header and trailer gathered
+            // around it), then, after the last payload, the parity frames.
+            for (size_t f = 0; f < 1 + parity.size(); ++f) {
+                const std::size_t idx = block_frames++;
+                std::size_t n = 0;
+                auto ec = (f == 0)
+                    ? sender.send_gather(data_frame.header_bytes(), pl, data_frame.trailer, n)
+                    : sender.send(std::span<const std::byte>(parity[f - 1].data(), parity[f - 1].size()), n);
+                auto ts = now_ms();
+                total_sent_bytes += n;
+                ++total_sent_frames;
+
+                if (ec) {
+                    std::cerr << "send error on frame " << idx << " (block " << b << "): " << ec.message() << "\n";
+                    m.add_row({
+                        std::to_string(ltfec::metrics::schema_version), run_id,
+                        std::to_string(ts), "sender", "send_error",
+                        dest_s, std::to_string(ep.port), std::to_string(n)
+                        });
+                    m.finish_with_summary(std::string("error: ") + ec.message());
+                    goto finish;
+                }
+                else {
+                    m.add_row({
+                        std::to_string(ltfec::metrics::schema_version), run_id,
+                        std::to_string(ts), "sender", (idx < static_cast<size_t>(N) ? "sent_data" : "sent_parity"),
+                        dest_s, std::to_string(ep.port), std::to_string(n)
+                        });
+                }
             }
 
             // Pace between data frames
-            if (i + 1 < static_cast<size_t>(N))
+            if (i + 1 < N)
                 std::this_thread::sleep_for(std::chrono::milliseconds(dt_ms));
         }
 
         std::cout << "sent block gen=" << gen << " (b=" << b << ") N=" << N << " K=" << K
-            << " frames=" << frames.size() << "\n";
+            << " frames=" << block_frames << "\n";
 
         if (inter_block_ms > 0)
             std::this_thread::sleep_for(std::chrono::milliseconds(inter_block_ms));
@@ -3,7 +3,6 @@
 #include <string>
 #include <vector>
 #include <optional>
-#include <unordered_map>
 #include <filesystem>
 #include <chrono>
 #include <cstddef>
@@ -36,6 +35,8 @@ int main(int argc, char** argv) {
     int expect_blocks = 1;
     int reorder_ms = 200;
     int fps = 30;
+    bool lazy_crc = false;
+    bool pass_through = false;
 
     po::options_description desc("Options");
     desc.add_options()
@@ -46,6 +47,8 @@ int main(int argc, char** argv) {
         ("expect-blocks", po::value<int>(&expect_blocks)->default_value(1), "Stop after closing this many blocks")
         ("reorder-ms", po::value<int>(&reorder_ms)->default_value(200), "Reorder window ms (>=50; 200 makes 60ms rule dominate)")
         ("fps", po::value<int>(&fps)->default_value(30), "Sender FPS hint (affects close rule 2span)")
+        ("lazy-crc", po::bool_switch(&lazy_crc), "Check CRC32C only when a frame is delivered or used for recovery")
+        ("pass-through", po::bool_switch(&pass_through), "Deliver data frames on arrival; closed blocks report only recovered frames")
         ;
 
     po::variables_map vm;
@@ -109,11 +112,10 @@ int main(int argc, char** argv) {
 
     RxBlockTable rxt({ .reorder_ms = static_cast<std::uint32_t>(reorder_ms),
                        .fps = static_cast<std::uint16_t>(fps),
-                       .max_payload_len = 1300 });
+                       .max_payload_len = 1300,
+                       .lazy_crc = lazy_crc });
 
-    // Track gens so we can close multiple blocks
     int closed_blocks = 0;
-    std::unordered_map<std::uint32_t, std::uint64_t> last_seen_ms;
 
     for (;;) {
         std::vector<std::byte> buf(4096);
@@ -137,7 +139,14 @@ int main(int argc, char** argv) {
         std::span<const std::byte> payload; std::uint32_t crc = 0;
         const std::span<const std::byte> in(buf.data(), n);
 
-        if (!decode_frame(in, h, has_parity, ps, payload, crc) || !verify_payload_crc(payload, crc)) {
+        // Lazy CRC: the table checks the trailer when it needs the frame (corrupt ones become erasures).
+        auto on_data = [&](const RxDataFrame& f) {
+            std::cout << "frame DELIVERED gen=" << f.gen << " seq=" << f.seq << " len=" << f.payload.size() << "\n";
+        };
+        const bool ok = decode_frame(in, h, has_parity, ps, payload, crc) &&
+            (pass_through ? rxt.ingest(ts, h, has_parity, ps, payload, crc, on_data)
+                          : rxt.ingest(ts, h, has_parity, ps, payload, crc));
+        if (!ok) {
             std::cerr << "decode/crc error on packet size " << n << "\n";
             m.add_row({
                 std::to_string(ltfec::metrics::schema_version), run_id,
@@ -147,9 +156,6 @@ int main(int argc, char** argv) {
             continue;
         }
 
-        rxt.ingest(ts, h, has_parity, ps, payload);
-        last_seen_ms[h.fec_gen_id] = ts;
-
         // Optional per-frame log
         std::cout << "rx " << (has_parity ? "PAR" : "DAT")
             << " gen=" << h.fec_gen_id
@@ -159,49 +165,35 @@ int main(int argc, char** argv) {
             << " from " << sender_ep.address().to_string() << ":" << sender_ep.port()
             << "\n";
 
-        // Try to close any gens that are ready (including this one)
-        for (auto it = last_seen_ms.begin(); it != last_seen_ms.end(); /*in-loop*/) {
-            const auto gen = it->first;
-            const auto tlast = it->second;
-            bool erased = false;
-
-            if (rxt.should_close(gen, ts)) {
-                RxClosedBlock closed{};
-                if (rxt.close_if_ready(gen, ts, closed)) {
-                    std::size_t recovered = 0, present = 0;
-                    for (std::uint16_t i = 0; i < closed.N; ++i) {
-                        if (!closed.data[i].empty()) ++present;
-                        if (closed.was_recovered[i]) ++recovered;
-                    }
-                    std::cout << "block CLOSED gen=" << closed.gen
-                        << " N=" << closed.N << " K=" << closed.K
-                        << " payload=" << closed.payload_len
-                        << " present=" << present
-                        << " recovered=" << recovered << "\n";
-
-                    m.add_row({
-                        std::to_string(ltfec::metrics::schema_version), run_id,
-                        std::to_string(ts), "receiver", "block_closed",
-                        listen_s, std::to_string(ep.port),
-                        std::to_string(present)
-                        });
-
-                    it = last_seen_ms.erase(it);
-                    erased = true;
-                    ++closed_blocks;
-                    if (closed_blocks >= expect_blocks) {
-                        m.finish_with_summary("ok");
-                        goto end;
-                    }
-                }
+        // Close whatever is due: blocks completed by this frame and blocks whose deadline passed.
+        // Leases: the payloads are read in place and the storage goes back to the pool afterwards.
+        rxt.poll(ts, [&](RxBlockLease&& closed) {
+            std::size_t recovered = 0, present = 0;
+            for (std::uint16_t i = 0; i < closed.N(); ++i) {
+                if (closed.present(i)) ++present;
+                if (closed.was_recovered(i)) ++recovered;
             }
+            std::cout << "block CLOSED gen=" << closed.gen()
+                << " N=" << closed.N() << " K=" << closed.K()
+                << " payload=" << closed.payload_len()
+                << " present=" << present
+                << " recovered=" << recovered
+                << " corrupt=" << closed.corrupt() << "\n";
 
-            if (!erased) ++it;
-            (void)tlast; // reserved for future timeouts logic
+            m.add_row({
+                std::to_string(ltfec::metrics::schema_version), run_id,
+                std::to_string(ts), "receiver", "block_closed",
+                listen_s, std::to_string(ep.port),
+                std::to_string(present)
+                });
+            ++closed_blocks;
+        });
+        if (closed_blocks >= expect_blocks) {
+            m.finish_with_summary("ok");
+            break;
         }
     }
 
-end:
     std::filesystem::create_directories("metrics");
     m.save_to_file(std::string("metrics\\receiver_") + run_id + ".csv");
     return 0;
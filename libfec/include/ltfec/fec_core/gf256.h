@@ -3,9 +3,21 @@
 #include <cstdint>
 #include <span>
 
-// Placeholders for GF(256) parity with 2..4 parity frames.
+// GF(256) parity encoders.
 namespace ltfec::fec_core {
 
+    // Coefficient of data index d in parity row j of a GF(256) linear block code.
+    using Gf256CoefFn = std::uint8_t(*)(std::size_t j, std::size_t d) noexcept;
+
+    // Vandermonde rows α^(j*d) (scheme ids gf256_k2..gf256_k4).
+    std::uint8_t vandermonde_coef(std::size_t j, std::size_t d) noexcept;
+
+    // parity[j] = Σ_d coef(j, d) * data[d] for every non-null parity row (no K limit).
+    void gf256_encode_rows(Gf256CoefFn coef,
+        std::span<const std::byte* const> data_frames,
+        std::size_t frame_len,
+        std::span<std::byte*> parity_frames) noexcept;
+
     void gf256_encode(std::span<const std::byte* const> data_frames,
         std::size_t frame_len,
         std::span<std::byte*> parity_frames /* K in [2..4] */) noexcept;
@@ -0,0 +1,40 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <ltfec/fec_core/gf256_field.h>
+#include <ltfec/fec_core/gf256_decode.h>  // kMaxInvertDim
+
+// Systematic Cauchy Reed-Solomon over GF(256) (scheme id cauchy_gf256).
+// Parity row j uses coefficient 1 / (x_j + y_d) with x_j = 255 - j and y_d = d. The two
+// point sets are disjoint while N + K <= 256, and every square submatrix of a Cauchy matrix
+// is invertible, so any m <= K erasures are recoverable from any m parity rows.
+namespace ltfec::fec_core {
+
+    // Upper bound on parity rows per block (one inversion of at most this dimension).
+    inline constexpr std::size_t kCauchyMaxParity = static_cast<std::size_t>(kMaxInvertDim);
+
+    constexpr std::uint8_t cauchy_coef(std::size_t j, std::size_t d) noexcept {
+        return gf256::inv(static_cast<std::uint8_t>((255u - j) ^ d));
+    }
+
+    // True if an N+K block fits the construction (1 <= K <= kCauchyMaxParity, N + K <= 256).
+    constexpr bool cauchy_supports(std::size_t N, std::size_t K) noexcept {
+        return N >= 1 && K >= 1 && K <= kCauchyMaxParity && N + K <= 256;
+    }
+
+    static_assert(cauchy_coef(0, 0) == gf256::inv(255), "x_0 = 255, y_0 = 0");
+
+    // Encode K parity frames; no-op if cauchy_supports(N, K) is false.
+    void gf256_cauchy_encode(std::span<const std::byte* const> data_frames,
+        std::size_t frame_len,
+        std::span<std::byte*> parity_frames) noexcept;
+
+    // Recover m missing data frames from any m received parity rows (see gf256_recover_erasures).
+    bool gf256_cauchy_recover(std::span<const std::byte* const> data_ptrs,
+        std::span<const std::byte* const> parity_ptrs,
+        std::size_t frame_len,
+        std::span<const std::uint16_t> missing_indices,
+        std::span<std::byte*> out_recovered) noexcept;
+
+} // namespace ltfec::fec_core
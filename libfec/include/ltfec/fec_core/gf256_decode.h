@@ -2,19 +2,49 @@
 #include <cstddef>
 #include <cstdint>
 #include <span>
+#include <ltfec/fec_core/gf256.h>  // Gf256CoefFn
 
-// Recover m missing data frames (m <= K <= 4) using up to K parity rows.
-// Parity row j uses coefficient α^(j*d) for data index d (same scheme as encoder).
-// - data_ptrs:  size N, nullptr where missing
-// - parity_ptrs: size K, nullptr if parity row missing/not arrived
-// - frame_len:  bytes per frame (all equal)
-// - missing_indices: size m, 0..N-1 indices for missing data frames
-// - out_recovered:   size m, buffers to write recovered payloads (len >= frame_len)
-// Returns true iff all m frames are recovered.
 namespace ltfec::fec_core {
+
+    // Largest matrix gf256_invert_matrix accepts.
+    inline constexpr int kMaxInvertDim = 32;
+
+    // Invert the row-major m×m matrix `a` over GF(256) in place (m <= kMaxInvertDim).
+    // Returns false if the matrix is singular; `a` is then left in an unspecified state.
+    bool gf256_invert_matrix(std::span<std::uint8_t> a, int m) noexcept;
+
+    // Solve for m missing data frames from pre-reduced parity rows (syndromes):
+    //   syndromes[j] = parity[j] ^ Σ_{present d} coef(j, d) * data[d], nullptr if row j is unavailable.
+    // Only the m×m inversion and m² region combinations remain, independent of N.
+    bool gf256_recover_from_syndromes(Gf256CoefFn coef,
+        std::span<const std::byte* const> syndromes,
+        std::size_t frame_len,
+        std::span<const std::uint16_t> missing_indices,
+        std::span<std::byte*> out_recovered) noexcept;
+
+    // Recover m missing data frames (m <= kMaxInvertDim) of any GF(256) linear block code whose
+    // parity row j uses coefficient coef(j, d) for data index d. Arguments as below.
+    bool gf256_recover_erasures(Gf256CoefFn coef,
+        std::span<const std::byte* const> data_ptrs,
+        std::span<const std::byte* const> parity_ptrs,
+        std::size_t frame_len,
+        std::span<const std::uint16_t> missing_indices,
+        std::span<std::byte*> out_recovered) noexcept;
+
+    // Recover m missing data frames (m <= K <= 4) using up to K parity rows.
+    // Parity row j uses coefficient α^(j*d) for data index d (same scheme as encoder).
+    // - data_ptrs:  size N, nullptr where missing
+    // - parity_ptrs: size K, nullptr if parity row missing/not arrived
+    // - frame_len:  bytes per frame (all equal)
+    // - missing_indices: size m, 0..N-1 indices for missing data frames
+    // - out_recovered:   size m, buffers to write recovered payloads (len >= frame_len)
+    // Returns true iff all m frames are recovered.
+    //
+    // The m×m system for the missing columns is inverted once per call; recovered payloads are
+    // then produced as whole-region linear combinations of the reduced parity rows.
     bool gf256_recover_erasures_vandermonde(std::span<const std::byte* const> data_ptrs,
         std::span<const std::byte* const> parity_ptrs,
         std::size_t frame_len,
         std::span<const std::uint16_t> missing_indices,
         std::span<std::byte*> out_recovered) noexcept;
-} // namespace ltfec::fec_core
\ No newline at end of file
+} // namespace ltfec::fec_core
@@ -0,0 +1,87 @@
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+// GF(2^8) field tables shared by the GF(256) encoder, decoder and region kernels.
+// Primitive polynomial x^8 + x^4 + x^3 + x^2 + 1 (0x11D), generator α = 2.
+//
+// Everything is generated at compile time: no lazy init, no first-use race, and no
+// zero-operand branch in mul() (row/column 0 of the product table is all zeros).
+// MSVC needs a raised /constexpr:steps budget for the 64 KiB table (see props/Common.props).
+namespace ltfec::fec_core::gf256 {
+
+    inline constexpr std::uint16_t kPoly = 0x11D;
+
+    namespace detail {
+
+        struct ExpLog {
+            std::array<std::uint8_t, 512> exp{}; // α^i, duplicated past 255 so exp[log a + log b] needs no modulo
+            std::array<std::uint8_t, 256> log{}; // log[0] unused
+        };
+
+        constexpr ExpLog make_exp_log() {
+            ExpLog t{};
+            std::uint16_t x = 1;
+            for (int i = 0; i < 255; ++i) {
+                t.exp[i] = static_cast<std::uint8_t>(x);
+                t.log[t.exp[i]] = static_cast<std::uint8_t>(i);
+                x <<= 1;
+                if (x & 0x100) x ^= kPoly;
+            }
+            for (int i = 255; i < 512; ++i) t.exp[i] = t.exp[i - 255];
+            return t;
+        }
+
+        inline constexpr ExpLog kExpLog = make_exp_log();
+
+        constexpr std::uint8_t mul_log(std::uint8_t a, std::uint8_t b) {
+            if (a == 0 || b == 0) return 0;
+            return kExpLog.exp[kExpLog.log[a] + kExpLog.log[b]];
+        }
+
+        constexpr std::array<std::uint8_t, 256> make_inv() {
+            std::array<std::uint8_t, 256> t{};
+            for (int a = 1; a < 256; ++a) t[a] = kExpLog.exp[255 - kExpLog.log[a]];
+            return t;
+        }
+
+        constexpr std::array<std::array<std::uint8_t, 256>, 256> make_mul() {
+            std::array<std::array<std::uint8_t, 256>, 256> t{};
+            for (int a = 1; a < 256; ++a)
+                for (int b = 1; b < 256; ++b)
+                    t[a][b] = mul_log(static_cast<std::uint8_t>(a), static_cast<std::uint8_t>(b));
+            return t;
+        }
+
+        // [c][0..15] = c*i, [c][16..31] = c*(i<<4): the PSHUFB split-nibble tables.
+        constexpr std::array<std::array<std::uint8_t, 32>, 256> make_nibble() {
+            std::array<std::array<std::uint8_t, 32>, 256> t{};
+            for (int c = 0; c < 256; ++c) {
+                for (int i = 0; i < 16; ++i) {
+                    t[c][i] = mul_log(static_cast<std::uint8_t>(c), static_cast<std::uint8_t>(i));
+                    t[c][16 + i] = mul_log(static_cast<std::uint8_t>(c), static_cast<std::uint8_t>(i << 4));
+                }
+            }
+            return t;
+        }
+
+    } // namespace detail
+
+    inline constexpr const std::array<std::uint8_t, 512>& kExp = detail::kExpLog.exp;
+    inline constexpr const std::array<std::uint8_t, 256>& kLog = detail::kExpLog.log;
+    inline constexpr std::array<std::uint8_t, 256> kInv = detail::make_inv();           // kInv[0] = 0
+    inline constexpr std::array<std::array<std::uint8_t, 256>, 256> kMul = detail::make_mul(); // 64 KiB
+    alignas(32) inline constexpr std::array<std::array<std::uint8_t, 32>, 256> kNibble = detail::make_nibble();
+
+    constexpr std::uint8_t add(std::uint8_t a, std::uint8_t b) noexcept { return a ^ b; }
+    constexpr std::uint8_t mul(std::uint8_t a, std::uint8_t b) noexcept { return kMul[a][b]; }
+    constexpr std::uint8_t inv(std::uint8_t a) noexcept { return kInv[a]; }
+    // α^e (any e; reduced mod 255)
+    constexpr std::uint8_t pow_alpha(unsigned e) noexcept { return kExp[e % 255]; }
+
+    static_assert(mul(2, 0x80) == 0x1D, "reduction by 0x11D");
+    static_assert(mul(0x53, inv(0x53)) == 1, "inverse table");
+    static_assert(pow_alpha(255) == 1, "α has order 255");
+
+} // namespace ltfec::fec_core::gf256
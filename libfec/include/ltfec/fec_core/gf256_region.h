@@ -0,0 +1,25 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <ltfec/util/cpu_features.h>
+
+// Region (whole-buffer) GF(256) primitives shared by the encoder and the erasure decoder.
+// Field: primitive polynomial 0x11D, generator α = 2 (same as gf256.h / gf256_decode.h).
+//
+// Kernels use the split-nibble technique: c*x = lo[x & 0x0F] ^ hi[x >> 4], where lo/hi are
+// 16-entry tables for the coefficient c, evaluated 16/32 bytes at a time with PSHUFB.
+// The best kernel for the running CPU is selected at runtime; scalar is always available.
+namespace ltfec::fec_core {
+
+    // dst[i] ^= c * src[i] for i in [0, len).
+    void gf256_mul_add_region(std::byte* dst, const std::byte* src, std::uint8_t c, std::size_t len) noexcept;
+
+    // dst[i] = c * src[i] for i in [0, len). dst may alias src.
+    void gf256_mul_region(std::byte* dst, const std::byte* src, std::uint8_t c, std::size_t len) noexcept;
+
+    // Same as above but forcing a kernel tier (clamped to what the CPU supports).
+    // Intended for tests and benchmarks.
+    void gf256_mul_add_region(std::byte* dst, const std::byte* src, std::uint8_t c, std::size_t len,
+        ltfec::util::SimdLevel level) noexcept;
+
+} // namespace ltfec::fec_core
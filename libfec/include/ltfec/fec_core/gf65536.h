@@ -0,0 +1,96 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <ltfec/util/cpu_features.h>
+
+// GF(2^16) systematic Cauchy Reed-Solomon (scheme id cauchy_gf65536) for blocks beyond the
+// 256-symbol GF(256) limit. Field: x^16 + x^12 + x^3 + x + 1 (0x1100B), generator α = 2.
+//
+// Payloads are sequences of 16-bit little-endian symbols, so frame lengths must be even.
+// Parity row j uses coefficient 1 / (x_j + y_d) with x_j = 65535 - j and y_d = d; the point
+// sets are disjoint while N + K <= 65536, and any m <= K erasures are recoverable from any m
+// parity rows. Region kernels use eight 16-entry split tables (one per nibble of the symbol,
+// low and high product byte) evaluated with PSHUFB.
+namespace ltfec::fec_core {
+
+    namespace gf65536 {
+
+        inline constexpr std::uint32_t kPoly = 0x1100B;
+
+        constexpr std::uint16_t add(std::uint16_t a, std::uint16_t b) noexcept { return a ^ b; }
+
+        // Log/exp table lookups; tables are built once on first use.
+        std::uint16_t mul(std::uint16_t a, std::uint16_t b) noexcept;
+        std::uint16_t inv(std::uint16_t a) noexcept;   // inv(0) == 0
+        std::uint16_t pow_alpha(std::uint32_t e) noexcept;
+
+    } // namespace gf65536
+
+    // Upper bound on parity rows per block: fec_parity_index and flags2's K-1 are 8-bit.
+    inline constexpr std::size_t kGf65536MaxParity = 256;
+
+    // Coefficient of data frame d in parity row j.
+    using Gf65536CoefFn = std::uint16_t(*)(std::size_t j, std::size_t d) noexcept;
+
+    inline std::uint16_t gf65536_cauchy_coef(std::size_t j, std::size_t d) noexcept {
+        return gf65536::inv(static_cast<std::uint16_t>((65535u - j) ^ d));
+    }
+
+    // True if an N+K block fits the construction (1 <= K <= kGf65536MaxParity, N + K <= 65536).
+    constexpr bool gf65536_cauchy_supports(std::size_t N, std::size_t K) noexcept {
+        return N >= 1 && K >= 1 && K <= kGf65536MaxParity && N + K <= 65536;
+    }
+
+    // dst ^= c * src over len bytes (len even; a trailing odd byte is left untouched).
+    void gf65536_mul_add_region(std::byte* dst, const std::byte* src, std::uint16_t c, std::size_t len) noexcept;
+
+    // dst ^= c * src where src is zero-padded to whole symbols: an odd trailing byte is taken as the
+    // low byte of a final symbol, so dst must hold len rounded up to even.
+    void gf65536_mul_add_padded(std::byte* dst, const std::byte* src, std::uint16_t c, std::size_t len) noexcept;
+
+    // dst = c * src over len bytes. dst may alias src.
+    void gf65536_mul_region(std::byte* dst, const std::byte* src, std::uint16_t c, std::size_t len) noexcept;
+
+    // Same as above but forcing a kernel tier (clamped to what the CPU supports).
+    // Intended for tests and benchmarks.
+    void gf65536_mul_add_region(std::byte* dst, const std::byte* src, std::uint16_t c, std::size_t len,
+        ltfec::util::SimdLevel level) noexcept;
+
+    // Invert the row-major m×m matrix `a` in place (m <= kGf65536MaxParity).
+    // Returns false if the matrix is singular.
+    bool gf65536_invert_matrix(std::span<std::uint16_t> a, int m) noexcept;
+
+    // Encode parity_frames.size() rows; frame_len must be even.
+    void gf65536_encode_rows(Gf65536CoefFn coef,
+        std::span<const std::byte* const> data_frames,
+        std::size_t frame_len,
+        std::span<std::byte*> parity_frames) noexcept;
+
+    // Same contract as gf256_recover_from_syndromes, over GF(2^16).
+    bool gf65536_recover_from_syndromes(Gf65536CoefFn coef,
+        std::span<const std::byte* const> syndromes,
+        std::size_t frame_len,
+        std::span<const std::uint16_t> missing_indices,
+        std::span<std::byte*> out_recovered) noexcept;
+
+    // Same contract as gf256_recover_erasures, over GF(2^16).
+    bool gf65536_recover_erasures(Gf65536CoefFn coef,
+        std::span<const std::byte* const> data_ptrs,
+        std::span<const std::byte* const> parity_ptrs,
+        std::size_t frame_len,
+        std::span<const std::uint16_t> missing_indices,
+        std::span<std::byte*> out_recovered) noexcept;
+
+    // Cauchy wrappers; no-op / false if gf65536_cauchy_supports(N, K) is false or frame_len is odd.
+    void gf65536_cauchy_encode(std::span<const std::byte* const> data_frames,
+        std::size_t frame_len,
+        std::span<std::byte*> parity_frames) noexcept;
+
+    bool gf65536_cauchy_recover(std::span<const std::byte* const> data_ptrs,
+        std::span<const std::byte* const> parity_ptrs,
+        std::size_t frame_len,
+        std::span<const std::uint16_t> missing_indices,
+        std::span<std::byte*> out_recovered) noexcept;
+
+} // namespace ltfec::fec_core
@@ -0,0 +1,21 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+// LT (Luby transform) code structure for the rateless mode (scheme id lt_fountain).
+// Encoding symbol esi < N is source symbol esi (systematic); esi >= N is the XOR of a set of
+// source symbols whose size follows the robust soliton distribution. Both sides derive the set
+// from (gen, esi) alone, so receivers can use any subset of frames in any order.
+namespace ltfec::fec_core {
+
+    // Robust soliton CDF for N sources: cdf[d-1] = P(degree <= d) scaled to 2^32 - 1 (size N).
+    // c and delta are the usual Luby parameters.
+    std::vector<std::uint32_t> lt_robust_soliton_cdf(std::size_t N, double c = 0.1, double delta = 0.5);
+
+    // Source indices XORed into repair symbol esi (esi >= N) of generation gen, distinct, unsorted.
+    void lt_neighbors(std::uint32_t gen, std::uint32_t esi, std::size_t N,
+        std::span<const std::uint32_t> cdf, std::vector<std::uint16_t>& out);
+
+} // namespace ltfec::fec_core
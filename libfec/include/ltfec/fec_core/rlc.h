@@ -0,0 +1,25 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+// Coefficients for the sliding-window random linear code (scheme id rlc_sliding).
+namespace ltfec::fec_core {
+
+    // Fill out[i] with the GF(256) coefficient of source first_esi + i in the repair frame
+    // identified by (first_esi, repair_key). Deterministic xorshift32 stream, never zero, so
+    // encoder and decoder derive the same row from the repair header alone.
+    inline void rlc_coefficients(std::uint32_t first_esi, std::uint8_t repair_key,
+        std::span<std::uint8_t> out) noexcept
+    {
+        std::uint32_t x = (first_esi * 0x9E3779B1u) ^ (static_cast<std::uint32_t>(repair_key) << 24) ^ 0x5A17C0DEu;
+        if (x == 0) x = 0xA3C59AC3u;
+        for (auto& c : out) {
+            x ^= x << 13;
+            x ^= x >> 17;
+            x ^= x << 5;
+            c = static_cast<std::uint8_t>(1u + (x >> 8) % 255u);
+        }
+    }
+
+} // namespace ltfec::fec_core
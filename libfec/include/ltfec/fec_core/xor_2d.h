@@ -0,0 +1,50 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+// Two-dimensional row/column XOR parity (scheme id xor_2d, SMPTE 2022-1 style).
+// The N = L×D data frames form a matrix of D rows and L columns (data index d sits at row d / L,
+// column d % L). Parity line j < L is the XOR of column j; line L + r is the XOR of row r, so
+// K = L + D. Recovery peels lines with exactly one missing member until no progress is made,
+// which repairs any burst of up to L consecutive frames with XOR-only cost.
+namespace ltfec::fec_core {
+
+    // True if N data frames fit an L-column matrix with K = L + N/L parity lines (K <= 256).
+    constexpr bool xor2d_supports(std::size_t N, std::size_t K, std::size_t columns) noexcept {
+        return columns >= 1 && N >= columns && N % columns == 0 && K == columns + N / columns && K <= 256;
+    }
+
+    // True if data index d belongs to parity line j.
+    constexpr bool xor2d_in_line(std::size_t j, std::size_t d, std::size_t columns) noexcept {
+        return j < columns ? (d % columns) == j : (d / columns) == (j - columns);
+    }
+
+    // Encode the K = L + D parity lines ([0..L) columns, [L..L+D) rows); no-op if unsupported.
+    void xor2d_encode(std::span<const std::byte* const> data_frames,
+        std::size_t frame_len,
+        std::size_t columns,
+        std::span<std::byte*> parity_frames) noexcept;
+
+    // Peel from line syndromes: syndromes[j] = parity[j] ^ XOR of the present members of line j
+    // (nullptr if parity line j is unavailable). missing has one flag per data index.
+    // Each recovered frame is written to out[d], its flag cleared, and folded out of the other
+    // syndromes (which are updated in place). Returns the number of frames recovered.
+    std::size_t xor2d_peel(std::span<std::byte* const> syndromes,
+        std::size_t frame_len,
+        std::size_t columns,
+        std::span<std::uint8_t> missing,
+        std::span<std::byte* const> out) noexcept;
+
+    // Convenience wrapper: build the syndromes from data/parity and peel.
+    // - data_ptrs:   size N, nullptr where missing
+    // - parity_ptrs: size K, nullptr where missing
+    // - out:         size N, output buffers (only entries for missing frames are written)
+    // Returns the number of frames recovered.
+    std::size_t xor2d_recover(std::span<const std::byte* const> data_ptrs,
+        std::span<const std::byte* const> parity_ptrs,
+        std::size_t frame_len,
+        std::size_t columns,
+        std::span<std::byte* const> out) noexcept;
+
+} // namespace ltfec::fec_core
@@ -0,0 +1,35 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <ltfec/util/cpu_features.h>
+
+// Multi-source XOR engine used by the XOR parity (K=1) encoder and single-erasure recovery.
+// Sources are folded up to kXorFoldWidth at a time, so N sources cost ceil(N / width)
+// read-modify-write sweeps of the destination instead of N. Kernels: AVX2 (256-bit),
+// SSE2 (128-bit) and a 64-bit scalar path for tails and non-x86 targets, picked at runtime.
+namespace ltfec::fec_core {
+
+    // Number of sources folded per pass over dst.
+    inline constexpr std::size_t kXorFoldWidth = 8;
+
+    // dst = seed ^ srcs[0] ^ ... ^ srcs[n-1] over len bytes.
+    // - seed: nullptr means zeros; may equal dst to accumulate in place.
+    // - srcs: nullptr entries are skipped; sources must not overlap dst (except via seed).
+    void xor_regions(std::byte* dst, const std::byte* seed,
+        std::span<const std::byte* const> srcs, std::size_t len) noexcept;
+
+    // Same as above but forcing a kernel tier (clamped to what the CPU supports).
+    // Intended for tests and benchmarks.
+    void xor_regions(std::byte* dst, const std::byte* seed,
+        std::span<const std::byte* const> srcs, std::size_t len,
+        ltfec::util::SimdLevel level) noexcept;
+
+    // Fused TX pass over one payload: dst = src, acc ^= src (acc may be nullptr) and the CRC32C
+    // state advanced over src. Works in L1-sized chunks, so src is pulled from memory once
+    // instead of once per consumer. Returns the updated state (crc32c_update semantics).
+    // dst may be nullptr (no copy: scatter-gather send); dst and acc must not overlap src or each other.
+    std::uint32_t copy_xor_crc32c(std::byte* dst, std::byte* acc, const std::byte* src,
+        std::size_t len, std::uint32_t crc_state) noexcept;
+
+} // namespace ltfec::fec_core
@@ -42,14 +42,7 @@ namespace ltfec::pipeline {
         bool should_close(std::uint64_t now_ms) const {
             if (!started_) return false;
             if (have_parity() && have_all_data()) return true;
-
-            const auto span_ms = block_span_ms();
-            const std::uint32_t min_ms = std::min<std::uint32_t>(60u, 2u * span_ms);
-            const std::uint64_t age = age_ms(now_ms);
-
-            if (age >= policy_.reorder_ms) return true;
-            if (age >= min_ms) return true;
-            return false;
+            return age_ms(now_ms) >= close_after_ms(policy_);
         }
 
         void reset() {
@@ -62,12 +55,6 @@ namespace ltfec::pipeline {
         const BlockPolicy& policy() const noexcept { return policy_; }
 
     private:
-        std::uint32_t block_span_ms() const {
-            if (policy_.fps == 0) return 0;
-            const std::uint64_t num = 1000ull * policy_.N + (policy_.fps - 1);
-            return static_cast<std::uint32_t>(num / policy_.fps);
-        }
-
         BlockPolicy policy_;
         bool started_{ false };
         bool parity_seen_{ false };
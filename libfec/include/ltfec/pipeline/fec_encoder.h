@@ -5,6 +5,10 @@
 #include <ltfec/protocol/ids.h>         // fec_scheme_id
 #include <ltfec/fec_core/xor_parity.h>  // K=1
 #include <ltfec/fec_core/gf256.h>       // K=2..4
+#include <ltfec/fec_core/gf256_cauchy.h> // K=5..32
+#include <ltfec/fec_core/gf65536.h>      // N+K > 256 or K > 32
+#include <ltfec/fec_core/gf256_region.h> // incremental accumulate
+#include <ltfec/fec_core/xor_2d.h>       // 2D row/column XOR
 
 namespace ltfec::pipeline {
 
@@ -12,11 +16,14 @@ namespace ltfec::pipeline {
         std::uint16_t N{ 8 };
         std::uint16_t K{ 1 };
         // If zero, scheme is chosen automatically from K:
-        //   K==1 → xor_k1; K in [2..4] → gf256_k{K}
+        //   K==1 → xor_k1; K in [2..4] → gf256_k{K} (N <= 255); K in [5..32] → cauchy_gf256 (N+K <= 256);
+        //   anything larger up to K=256, N+K=65536 → cauchy_gf65536
         std::uint8_t fec_scheme_id{ 0 };
+        // xor_2d only (never picked automatically): column count L, with N = L×D and K = L + D.
+        std::uint8_t columns{ 0 };
     };
 
-    // Thin façade that dispatches to XOR or GF(256) parity encoders.
+    // Thin façade that dispatches to XOR, GF(256) or GF(2^16) parity encoders.
     // All frames must be equal length.
     class FecEncoder {
     public:
@@ -32,31 +39,106 @@ namespace ltfec::pipeline {
             std::span<std::byte*> parity_frames) const noexcept
         {
             const auto scheme = pick_scheme_id();
-            if (scheme == static_cast<std::uint8_t>(protocol::fec_scheme_id::xor_k1)) {
+            switch (static_cast<protocol::fec_scheme_id>(scheme)) {
+            case protocol::fec_scheme_id::xor_k1:
                 // Expect exactly one parity buffer
                 if (parity_frames.size() >= 1 && parity_frames[0]) {
                     ltfec::fec_core::xor_parity_1(data_frames, frame_len,
                         std::span<std::byte>(parity_frames[0], frame_len));
                 }
-            }
-            else {
-                // GF(256) supports K in [2..4]
+                break;
+            case protocol::fec_scheme_id::cauchy_gf256:
+                // Any K in [1..32] with N+K <= 256
+                ltfec::fec_core::gf256_cauchy_encode(data_frames, frame_len, parity_frames);
+                break;
+            case protocol::fec_scheme_id::xor_2d:
+                ltfec::fec_core::xor2d_encode(data_frames, frame_len, cfg_.columns, parity_frames);
+                break;
+            case protocol::fec_scheme_id::cauchy_gf65536:
+                // Large blocks; frame_len must be even (see protected_len)
+                ltfec::fec_core::gf65536_cauchy_encode(data_frames, frame_len, parity_frames);
+                break;
+            default:
+                // GF(256) Vandermonde supports K in [2..4]
                 ltfec::fec_core::gf256_encode(data_frames, frame_len, parity_frames);
+                break;
             }
             return scheme;
         }
 
+        // Fold data frame d into the K parity accumulators (every scheme here is linear).
+        // The accumulators must be zeroed at the start of the block; once all N data frames have
+        // been folded (in any order) they hold exactly what encode() would have produced.
+        // frame_len may be shorter than the accumulators (the frame counts as zero-padded), which
+        // must then be at least protected_len(frame_len) bytes.
+        void accumulate(std::size_t d,
+            const std::byte* data_frame,
+            std::size_t frame_len,
+            std::span<std::byte*> parity_frames) const noexcept
+        {
+            if (!data_frame || frame_len == 0) return;
+            const auto scheme = static_cast<protocol::fec_scheme_id>(pick_scheme_id());
+            if (scheme == protocol::fec_scheme_id::cauchy_gf65536) {
+                for (std::size_t j = 0; j < parity_frames.size(); ++j) {
+                    if (!parity_frames[j]) continue;
+                    ltfec::fec_core::gf65536_mul_add_padded(parity_frames[j], data_frame,
+                        ltfec::fec_core::gf65536_cauchy_coef(j, d), frame_len);
+                }
+                return;
+            }
+            for (std::size_t j = 0; j < parity_frames.size(); ++j) {
+                if (!parity_frames[j]) continue;
+                std::uint8_t c = 0;
+                switch (scheme) {
+                case protocol::fec_scheme_id::xor_k1:       c = (j == 0) ? 1 : 0; break;
+                case protocol::fec_scheme_id::cauchy_gf256: c = ltfec::fec_core::cauchy_coef(j, d); break;
+                case protocol::fec_scheme_id::xor_2d:       c = ltfec::fec_core::xor2d_in_line(j, d, cfg_.columns) ? 1 : 0; break;
+                default:                                    c = ltfec::fec_core::vandermonde_coef(j, d); break;
+                }
+                ltfec::fec_core::gf256_mul_add_region(parity_frames[j], data_frame, c, frame_len);
+            }
+        }
+
         // Scheme chosen from cfg (see comment above)
         std::uint8_t pick_scheme_id() const noexcept {
             if (cfg_.fec_scheme_id) return cfg_.fec_scheme_id;
             if (cfg_.K == 1) return static_cast<std::uint8_t>(protocol::fec_scheme_id::xor_k1);
-            if (cfg_.K == 2) return static_cast<std::uint8_t>(protocol::fec_scheme_id::gf256_k2);
-            if (cfg_.K == 3) return static_cast<std::uint8_t>(protocol::fec_scheme_id::gf256_k3);
-            if (cfg_.K == 4) return static_cast<std::uint8_t>(protocol::fec_scheme_id::gf256_k4);
+            if (cfg_.N <= 255) {
+                if (cfg_.K == 2) return static_cast<std::uint8_t>(protocol::fec_scheme_id::gf256_k2);
+                if (cfg_.K == 3) return static_cast<std::uint8_t>(protocol::fec_scheme_id::gf256_k3);
+                if (cfg_.K == 4) return static_cast<std::uint8_t>(protocol::fec_scheme_id::gf256_k4);
+            }
+            if (ltfec::fec_core::cauchy_supports(cfg_.N, cfg_.K))
+                return static_cast<std::uint8_t>(protocol::fec_scheme_id::cauchy_gf256);
+            if (ltfec::fec_core::gf65536_cauchy_supports(cfg_.N, cfg_.K))
+                return static_cast<std::uint8_t>(protocol::fec_scheme_id::cauchy_gf65536);
             // Out-of-scope K: default to xor_k1 as a safe sentinel (no-op beyond first)
             return static_cast<std::uint8_t>(protocol::fec_scheme_id::xor_k1);
         }
 
+        // True if the chosen scheme can produce all K parity rows for this N (K==0 is trivially valid).
+        bool valid() const noexcept {
+            if (cfg_.K == 0) return true;
+            switch (static_cast<protocol::fec_scheme_id>(pick_scheme_id())) {
+            case protocol::fec_scheme_id::xor_k1:       return cfg_.K == 1;
+            case protocol::fec_scheme_id::gf256_k2:     return cfg_.K == 2;
+            case protocol::fec_scheme_id::gf256_k3:     return cfg_.K == 3;
+            case protocol::fec_scheme_id::gf256_k4:     return cfg_.K == 4;
+            case protocol::fec_scheme_id::cauchy_gf256: return ltfec::fec_core::cauchy_supports(cfg_.N, cfg_.K);
+            case protocol::fec_scheme_id::xor_2d:       return ltfec::fec_core::xor2d_supports(cfg_.N, cfg_.K, cfg_.columns);
+            case protocol::fec_scheme_id::cauchy_gf65536: return ltfec::fec_core::gf65536_cauchy_supports(cfg_.N, cfg_.K);
+            default:                                    return false; // not a block code (e.g. rlc_sliding)
+            }
+        }
+
+        // Parity width protecting data frames of up to frame_len bytes: GF(2^16) works on whole
+        // 16-bit symbols, so odd lengths round up by one; every other scheme is byte-wise.
+        std::size_t protected_len(std::size_t frame_len) const noexcept {
+            if (cfg_.K == 0) return frame_len;
+            const bool wide = pick_scheme_id() == static_cast<std::uint8_t>(protocol::fec_scheme_id::cauchy_gf65536);
+            return wide ? (frame_len + 1) & ~static_cast<std::size_t>(1) : frame_len;
+        }
+
         const FecEncoderConfig& config() const noexcept { return cfg_; }
 
     private:
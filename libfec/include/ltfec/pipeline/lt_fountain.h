@@ -0,0 +1,107 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <span>
+#include <ltfec/protocol/frame.h>
+#include <ltfec/protocol/frame_builder.h>
+#include <ltfec/pipeline/rx_block_table.h>
+
+// Rateless LT fountain mode (fec_scheme_id::lt_fountain).
+//
+// Wire mapping (all frames carry protocol::k_flags1_fountain in flags1):
+//   fec_gen_id = object id, data_count = N sources, parity_count = 1 (nominal),
+//   seq_in_block = encoding symbol id (ESI). ESI < N is a plain data frame carrying source ESI;
+//   ESI >= N is a parity frame with subheader {lt_fountain, ESI & 0xFF} whose payload is the
+//   XOR of fec_core::lt_neighbors(object id, ESI, N). A receiver can finish from any ~N(1+e)
+//   distinct frames, whichever ones survive.
+namespace ltfec::pipeline {
+
+    struct LtConfig {
+        std::uint16_t max_payload_len{ 1300 };
+
+        // Leaves most of the 16-bit ESI space for repair symbols.
+        static constexpr std::uint16_t kMaxSources = 4096;
+    };
+
+    // TX side: holds one object and emits encoding symbols on demand.
+    class LtEncoder {
+    public:
+        explicit LtEncoder(LtConfig cfg = {});
+
+        // Copy the N source payloads (all the same length) of object gen and rewind to ESI 0.
+        bool start_object(std::uint32_t gen, const std::vector<std::span<const std::byte>>& sources) noexcept;
+
+        // Frame for encoding symbol esi. Returns false if no object is loaded or esi is out of range.
+        bool encode_symbol(std::uint16_t esi, std::vector<std::byte>& out_frame) noexcept;
+
+        // Frame for the next ESI in order (sources first, then repair symbols).
+        bool next_frame(std::vector<std::byte>& out_frame) noexcept;
+
+        std::uint32_t next_esi() const noexcept { return next_esi_; }
+        std::uint16_t source_count() const noexcept { return N_; }
+
+    private:
+        LtConfig cfg_;
+        std::uint32_t gen_{ 0 };
+        std::uint16_t N_{ 0 };
+        std::uint32_t next_esi_{ 0 };
+        std::size_t payload_len_{ 0 };
+        std::vector<std::vector<std::byte>> sources_;  // [N][payload_len_]
+        std::vector<std::uint32_t> cdf_;               // robust soliton CDF for N_
+        std::vector<std::uint16_t> neighbors_;
+        std::vector<const std::byte*> srcs_;
+        std::vector<std::byte> symbol_;
+    };
+
+    // RX side: peeling decoder for one object. Received sources are stored directly; each repair
+    // symbol is XOR-reduced by the sources already known and, once a single unknown remains,
+    // releases it, which may in turn reduce other waiting symbols to degree one.
+    class LtDecoder {
+    public:
+        explicit LtDecoder(LtConfig cfg = {});
+
+        // Ingest a decoded frame. The first frame binds the decoder to its object.
+        // Returns false if the frame does not belong to this object or is malformed.
+        bool ingest(const ltfec::protocol::BaseHeader& h,
+            bool has_parity_sub,
+            const ltfec::protocol::ParitySubheader& ps,
+            std::span<const std::byte> payload);
+
+        bool complete() const noexcept { return N_ != 0 && known_count_ == N_; }
+        std::size_t known_sources() const noexcept { return known_count_; }
+        std::size_t frames_received() const noexcept { return received_; }
+        std::size_t pending_symbols() const noexcept { return pending_; }
+
+        // Once complete, move the object out (K = 0: rateless). The decoder is then reset.
+        bool extract(RxClosedBlock& out);
+        void reset();
+
+    private:
+        struct Symbol {
+            std::vector<std::uint16_t> unknown;   // source indices not yet known
+            std::vector<std::byte> value;         // payload XOR all known neighbours
+        };
+
+        void resolve(std::uint16_t src, std::vector<std::byte> value, bool recovered);
+
+        LtConfig cfg_;
+        bool bound_{ false };
+        std::uint32_t gen_{ 0 };
+        std::uint16_t N_{ 0 };
+        std::size_t payload_len_{ 0 };
+        std::size_t known_count_{ 0 };
+        std::size_t received_{ 0 };
+        std::size_t pending_{ 0 };
+        std::vector<std::vector<std::byte>> sources_;   // [N], empty until known
+        std::vector<bool> have_;
+        std::vector<bool> recovered_;
+        std::vector<bool> seen_repair_;                 // [65536 - N], duplicate filter
+        std::vector<Symbol> symbols_;
+        std::vector<std::vector<std::uint32_t>> waiting_; // [N] -> symbols still listing the source
+        std::vector<std::uint32_t> cdf_;
+        std::vector<std::uint16_t> neighbors_;
+        std::vector<const std::byte*> srcs_;
+    };
+
+} // namespace ltfec::pipeline
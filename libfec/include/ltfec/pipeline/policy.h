@@ -1,4 +1,5 @@
 #pragma once
+#include <algorithm>
 #include <cstdint>
 
 namespace ltfec::pipeline {
@@ -8,6 +9,23 @@ namespace ltfec::pipeline {
         std::uint16_t K{ 1 };
         std::uint32_t reorder_ms{ 50 }; // default from DESIGN.md
         std::uint32_t fps{ 30 };        // frames per second
+        std::uint16_t interleave_depth{ 1 }; // D blocks interleaved on the wire: each spans D× longer
     };
 
+    // Time to send one block at fps frames per second (0 if fps is unknown).
+    inline std::uint32_t block_span_ms(const BlockPolicy& p) noexcept {
+        if (p.fps == 0) return 0;
+        const std::uint64_t num = 1000ull * p.N + (p.fps - 1);
+        return static_cast<std::uint32_t>(num / p.fps);
+    }
+
+    // Block age at which the time rules close it: min(reorder_ms, min(60 ms, 2 x span)). With
+    // depth-D interleaving a block's frames are spread over D block spans, so both bounds
+    // stretch by D.
+    inline std::uint64_t close_after_ms(const BlockPolicy& p) noexcept {
+        const std::uint32_t depth = std::max<std::uint32_t>(1u, p.interleave_depth);
+        const std::uint32_t min_ms = depth * std::min<std::uint32_t>(60u, 2u * block_span_ms(p));
+        return std::min<std::uint64_t>(static_cast<std::uint64_t>(p.reorder_ms) * depth, min_ms);
+    }
+
 } // namespace ltfec::pipeline
\ No newline at end of file
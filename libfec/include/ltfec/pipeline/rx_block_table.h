@@ -3,15 +3,26 @@
 #include <cstddef>
 #include <vector>
 #include <unordered_map>
+#include <memory>
 #include <optional>
 #include <span>
+#include <type_traits>
 #include <algorithm>
+#include <bit>
+#include <cstring>
+#include <utility>
 #include <ltfec/fec_core/gf256_decode.h>
+#include <ltfec/fec_core/gf256_cauchy.h>
+#include <ltfec/fec_core/gf256_region.h>
+#include <ltfec/fec_core/gf65536.h>
+#include <ltfec/fec_core/xor_2d.h>
+#include <ltfec/pipeline/fec_encoder.h>
 #include <ltfec/pipeline/policy.h>
-#include <ltfec/pipeline/block_state.h>
-#include <ltfec/pipeline/block_tracker.h>
+#include <ltfec/pipeline/rx_slab_pool.h>
 #include <ltfec/fec_core/block_xor.h>
 #include <ltfec/protocol/frame.h>
+#include <ltfec/protocol/ids.h>
+#include <ltfec/util/crc32c.h>
 
 namespace ltfec::pipeline {
 
@@ -20,6 +31,17 @@ namespace ltfec::pipeline {
         std::uint32_t reorder_ms{ 50 };
         std::uint32_t fps{ 30 };
         std::uint16_t max_payload_len{ 1300 };
+        // TX interleave depth D (TxConfig::interleave_depth); up to D blocks are open at once and
+        // close timers stretch by D.
+        std::uint16_t interleave_depth{ 1 };
+        // Lazy CRC: frames ingested with their CRC32C trailer are checked only when a close
+        // delivers them (data) or needs them for recovery (parity); a corrupt frame then counts
+        // as an erasure. Off: the CRC is checked on ingest and corrupt frames are refused.
+        bool lazy_crc{ false };
+        // Ring slots for open generations, rounded up to a power of two and at least
+        // 4 x interleave_depth. Blocks further behind the newest generation than this live in
+        // an overflow map instead.
+        std::uint16_t gen_window{ 16 };
     };
 
     // Snapshot for tests/metrics.
@@ -35,68 +57,279 @@ namespace ltfec::pipeline {
     struct RxClosedBlock {
         std::uint32_t gen{ 0 };
         std::uint16_t N{ 0 }, K{ 0 };
-        std::uint16_t payload_len{ 0 };
-        std::vector<std::vector<std::byte>> data;   // size N, each payload_len bytes
+        std::uint16_t payload_len{ 0 };             // block width (widest payload / parity length)
+        std::vector<std::vector<std::byte>> data;   // size N, each at its original length (empty if lost)
         std::vector<bool> was_recovered;            // size N, true if payload was reconstructed
+        std::uint16_t corrupt{ 0 };                 // frames dropped by lazy CRC verification
+        std::vector<bool> delivered;                // size N, true if passed through on arrival (data[i] left empty)
+    };
+
+    // A data frame handed to the application on arrival (pass-through delivery, see
+    // RxBlockTable::ingest). payload is only valid during the callback.
+    struct RxDataFrame {
+        std::uint32_t gen{ 0 };
+        std::uint16_t seq{ 0 };                     // seq_in_block
+        std::span<const std::byte> payload;
+    };
+
+    // Closed block that still owns its RX slab: the payloads are views into the block's own
+    // storage, recovered frames included, so nothing is copied on close. The slab goes back to
+    // the table's pool on release() or destruction; views are invalid after that. Leases may
+    // outlive the table, but must be released on the thread that drives it (the pool is not
+    // synchronized).
+    class RxBlockLease {
+    public:
+        // Bitmasks at the head of RxBlock's slab, N+K bits each: seen, recovered, delivered.
+        static constexpr std::size_t kMasks = 3;
+
+        RxBlockLease() = default;
+        ~RxBlockLease() { release(); }
+        RxBlockLease(RxBlockLease&&) noexcept = default;
+        RxBlockLease& operator=(RxBlockLease&& o) noexcept {
+            if (this != &o) {
+                release();
+                gen_ = o.gen_; N_ = o.N_; K_ = o.K_;
+                payload_len_ = o.payload_len_;
+                corrupt_ = o.corrupt_;
+                stride_ = o.stride_; head_ = o.head_; mask_words_ = o.mask_words_;
+                pool_ = std::move(o.pool_);
+                slab_ = std::move(o.slab_);
+            }
+            return *this;
+        }
+
+        std::uint32_t gen() const noexcept { return gen_; }
+        std::uint16_t N() const noexcept { return N_; }
+        std::uint16_t K() const noexcept { return K_; }
+        std::uint16_t payload_len() const noexcept { return payload_len_; } // block width
+        std::uint16_t corrupt() const noexcept { return corrupt_; }         // frames dropped by lazy CRC
+
+        // Data frame i at its original length; empty if lost (or once released).
+        std::span<const std::byte> data(std::uint16_t i) const noexcept {
+            if (!present(i)) return {};
+            const std::byte* base = slab_.data();
+            const auto* lens = reinterpret_cast<const std::uint16_t*>(base + 8 * kMasks * mask_words_);
+            return std::span<const std::byte>(base + head_ + i * stride_, lens[i]);
+        }
+        bool present(std::uint16_t i) const noexcept { return i < N_ && bit(0, i); }
+        bool was_recovered(std::uint16_t i) const noexcept { return present(i) && bit(mask_words_, i); }
+        // Already handed out on arrival (pass-through delivery); data(i) still shows it.
+        bool delivered(std::uint16_t i) const noexcept { return present(i) && bit(2 * mask_words_, i); }
+
+        // Give the storage back (idempotent).
+        void release() noexcept {
+            if (!slab_) return;
+            if (pool_) pool_->release(std::move(slab_));
+            else slab_ = RxSlabPool::Slab{};
+            pool_.reset();
+        }
+
+    private:
+        friend class RxBlock;
+        friend class RxBlockTable;
+
+        bool bit(std::size_t word0, std::size_t i) const noexcept {
+            if (!slab_) return false;
+            const auto* m = reinterpret_cast<const std::uint64_t*>(slab_.data());
+            return (m[word0 + (i >> 6)] >> (i & 63)) & 1u;
+        }
+
+        std::uint32_t gen_{ 0 };
+        std::uint16_t N_{ 0 }, K_{ 0 };
+        std::uint16_t payload_len_{ 0 };
+        std::uint16_t corrupt_{ 0 };
+        std::size_t stride_{ 0 }, head_{ 0 }, mask_words_{ 0 }; // RxBlock's slab layout
+        std::shared_ptr<RxSlabPool> pool_;
+        RxSlabPool::Slab slab_;
     };
 
     // Internal per-generation state.
+    //
+    // All frames of the block live in one 64-byte aligned slab (from the table's RxSlabPool):
+    //   [ seen, recovered, delivered bitmasks ][ frame lengths ]  padded to a cache line
+    //   [ N data rows ][ K parity rows ][ K syndrome rows ]    stride_ bytes each
+    // Row f holds frame f (data 0..N-1, then parity) zero-padded to the stride, so any present
+    // frame can be used at block width in place. Counts are popcounts over the bitmask.
     class RxBlock {
     public:
-        RxBlock(std::uint32_t gen, std::uint16_t N, std::uint16_t K, std::uint16_t payload_len, const RxConfig& cfg)
-            : gen_(gen),
-            policy_{ N, K, cfg.reorder_ms, cfg.fps },
-            state_(policy_),
-            tracker_(policy_),
-            payload_len_(payload_len),
-            data_(N),
-            parity_(K)
+        // columns: 2D XOR column count from flags2 (0 for every other scheme).
+        // pool: where the slab comes from and goes back to (nullptr: plain allocation).
+        RxBlock(std::uint32_t gen, std::uint16_t N, std::uint16_t K, std::uint16_t payload_len, const RxConfig& cfg,
+            std::uint8_t columns = 0, RxSlabPool* pool = nullptr)
+            : pool_(pool)
         {
+            reset(gen, N, K, payload_len, cfg, columns);
         }
 
-        // Store one frame (copy payload) and update trackers.
-        void ingest(std::uint64_t now_ms,
+        ~RxBlock() { release_storage(); }
+        RxBlock(RxBlock&&) noexcept = default;
+        RxBlock& operator=(RxBlock&&) = delete; // would drop the slab instead of returning it
+
+        // Same as constructing the block afresh; the slab comes from the pool (RxBlockTable
+        // reuses ring slots this way).
+        void reset(std::uint32_t gen, std::uint16_t N, std::uint16_t K, std::uint16_t payload_len, const RxConfig& cfg,
+            std::uint8_t columns = 0)
+        {
+            policy_ = BlockPolicy{ N, K, cfg.reorder_ms, cfg.fps, cfg.interleave_depth };
+            gen_ = gen;
+            payload_len_ = payload_len;
+            width_fixed_ = false;
+            lens_.clear();
+            scheme_ = 0;
+            started_ = false;
+            start_ms_ = last_ms_ = 0;
+            data_crc_.assign(N, std::nullopt);
+            parity_crc_.assign(K, std::nullopt);
+
+            // Syndromes are folded under the scheme the TX would pick for this N/K; a parity
+            // frame announcing a different scheme switches the block to the full solve at close.
+            // 2D XOR blocks announce themselves on every frame, so there is nothing to assume.
+            const FecEncoder assumed = columns
+                ? FecEncoder(FecEncoderConfig{ N, K, static_cast<std::uint8_t>(ltfec::protocol::fec_scheme_id::xor_2d), columns })
+                : FecEncoder(FecEncoderConfig{ N, K, 0 });
+            columns_ = columns;
+            syn_scheme_ = 0;
+            if (K > 0 && assumed.valid()) {
+                syn_scheme_ = assumed.pick_scheme_id();
+                payload_len_ = static_cast<std::uint16_t>(assumed.protected_len(payload_len));
+            }
+
+            release_storage();
+            if (frames() == 0) return;
+            head_ = head_bytes(mask_words(), frames());
+            stride_ = align_up(std::max<std::size_t>(payload_len_, 1));
+            slab_ = acquire(slab_bytes(stride_));
+            if (!slab_) return; // frames are dropped; the block closes with nothing
+            std::memset(slab_.data(), 0, head_);
+            std::memset(row(frames()), 0, K * stride_); // syndromes start at zero
+        }
+
+        // Hand the slab back to the pool (the block is left empty).
+        void release_storage() noexcept {
+            if (!slab_) return;
+            if (pool_) pool_->release(std::move(slab_));
+            else slab_ = RxSlabPool::Slab{};
+        }
+
+        // Store one frame (copy payload) and update the bitmask.
+        // scheme_id is the parity subheader's fec_scheme_id; the first parity frame fixes it for the block.
+        // Data frames may be shorter than the block width (they count as zero-padded); the width
+        // grows with the widest data frame until a parity frame fixes it. Frames that do not fit
+        // a fixed width are dropped.
+        // Each new frame is also folded into the running per-row syndromes
+        //   syn[j] = parity[j] ^ Σ_{present d} coef(j, d) * data[d]
+        // so closing only has to solve for the missing frames. Duplicates keep the first copy.
+        // unverified_crc: the frame's CRC32C trailer when it has not been checked yet (lazy CRC);
+        // verify_pending checks it before the frame is used.
+        // Returns true if the frame was stored (false: duplicate, out of range or dropped).
+        bool ingest(std::uint64_t now_ms,
             bool is_parity,
             std::uint16_t seq_in_block,
             std::uint8_t parity_index,
-            std::span<const std::byte> payload)
+            std::span<const std::byte> payload,
+            std::uint8_t scheme_id = 0,
+            std::optional<std::uint32_t> unverified_crc = std::nullopt)
         {
-            if (!started_) { started_ = true; tracker_.start(now_ms); start_ms_ = now_ms; }
+            if (!started_) { started_ = true; start_ms_ = now_ms; }
+            last_ms_ = now_ms;
+            if (!slab_) return false;
             if (is_parity) {
-                if (parity_index < parity_.size()) {
-                    parity_[parity_index].assign(payload.begin(), payload.end());
-                    state_.mark_parity(parity_index);
-                    tracker_.mark_parity(parity_index, now_ms);
+                if (scheme_ == 0) scheme_ = scheme_id;
+                if (scheme_id != 0 && scheme_id != syn_scheme_) syn_scheme_ = 0; // mismatch: full solve at close
+                const std::size_t f = policy_.N + std::size_t{ parity_index };
+                if (parity_index < policy_.K && !seen(f) && fit_width(payload.size(), /*parity*/true)) {
+                    store(f, payload);
+                    parity_crc_[parity_index] = unverified_crc;
+                    fold_syndrome(parity_index, 1, payload);
+                    return true;
                 }
             }
             else {
-                if (seq_in_block < data_.size()) {
-                    data_[seq_in_block].assign(payload.begin(), payload.end());
-                    state_.mark_data(seq_in_block);
-                    tracker_.mark_data(seq_in_block, now_ms);
+                if (seq_in_block < policy_.N && !seen(seq_in_block) && fit_width(payload.size(), /*parity*/false)) {
+                    store(seq_in_block, payload);
+                    data_crc_[seq_in_block] = unverified_crc;
+                    fold_data(seq_in_block, payload);
+                    return true;
                 }
             }
-            last_ms_ = now_ms;
+            return false;
+        }
+
+        // Data frame i was handed to the application on arrival; closing does not repeat it.
+        void mark_delivered(std::uint16_t i) noexcept {
+            if (seen(i)) delivered_mask()[i >> 6] |= std::uint64_t{ 1 } << (i & 63);
+        }
+
+        // Protected lengths from a k_flags1_varlen parity frame (N u16 LE values, or one shared by
+        // all N with k_flags1_common_len).
+        void note_lengths(std::span<const std::byte> table) {
+            const bool common = table.size() == ltfec::protocol::varlen_table_size(1);
+            if (!lens_.empty() || (!common && table.size() != ltfec::protocol::varlen_table_size(policy_.N))) return;
+            lens_.resize(policy_.N);
+            for (std::uint16_t i = 0; i < policy_.N; ++i) {
+                const std::size_t at = common ? 0u : 2u * i;
+                lens_[i] = static_cast<std::uint16_t>(std::to_integer<std::uint16_t>(table[at]) |
+                    (std::to_integer<std::uint16_t>(table[at + 1]) << 8));
+            }
+        }
+
+        // Lazy CRC: check the unverified frames a close is about to use. Every present data frame
+        // is delivered, so all of them are checked; parity only if some data frame is missing.
+        // A corrupt frame becomes an erasure (a data frame is first folded out of the syndromes
+        // again: folding is an XOR, so a second fold cancels the first). Returns the count dropped.
+        std::uint16_t verify_pending() {
+            std::uint16_t dropped = 0;
+            for (std::uint16_t i = 0; i < policy_.N; ++i) {
+                if (data_crc_[i] && seen(i) && ltfec::util::crc32c(frame(i)) != *data_crc_[i]) {
+                    fold_data(i, frame(i));
+                    unmark(i);
+                    ++dropped;
+                }
+                data_crc_[i].reset();
+            }
+            if (data_seen() == policy_.N) return dropped;
+            for (std::uint16_t j = 0; j < policy_.K; ++j) {
+                // A dropped parity row is skipped by every recovery path, so its syndrome can stay.
+                const std::size_t f = policy_.N + std::size_t{ j };
+                if (parity_crc_[j] && seen(f) && ltfec::util::crc32c(frame(f)) != *parity_crc_[j]) {
+                    unmark(f);
+                    ++dropped;
+                }
+                parity_crc_[j].reset();
+            }
+            return dropped;
         }
 
-        bool should_close(std::uint64_t now_ms) const { return tracker_.should_close(now_ms); }
+        bool should_close(std::uint64_t now_ms) const {
+            if (!started_) return false;
+            if (complete()) return true;
+            const std::uint64_t age = now_ms >= start_ms_ ? now_ms - start_ms_ : 0;
+            return age >= close_after_ms(policy_);
+        }
+        // Fast-path close condition (all data and some parity present).
+        bool complete() const { return data_seen() == policy_.N && parity_seen() > 0; }
+        // Time-based close deadline; valid after the first ingest.
+        std::uint64_t deadline_ms() const { return start_ms_ + close_after_ms(policy_); }
 
         RxSnapshot snapshot() const {
             RxSnapshot s;
             s.N = policy_.N; s.K = policy_.K;
-            s.data_seen = state_.data_seen_count();
-            s.parity_seen = state_.parity_seen_count();
-            s.have_all_data = state_.have_all_data();
-            s.have_any_parity = state_.have_any_parity();
+            s.data_seen = data_seen();
+            s.parity_seen = parity_seen();
+            s.have_all_data = s.data_seen == policy_.N;
+            s.have_any_parity = s.parity_seen > 0;
             s.payload_len = payload_len_;
             return s;
         }
 
         std::uint32_t gen() const noexcept { return gen_; }
         std::uint16_t payload_len() const noexcept { return payload_len_; }
+        std::uint8_t scheme_id() const noexcept { return scheme_; }
 
-        // Build the closed-block result (perform XOR single-erasure recovery for K=1 if possible).
-        RxClosedBlock extract_closed() const {
+        // Build the closed-block result (recovering what the parity allows), copying the payloads
+        // out of the slab.
+        RxClosedBlock extract_closed() {
+            recover();
             RxClosedBlock out;
             out.gen = gen_;
             out.N = policy_.N;
@@ -104,155 +337,695 @@ namespace ltfec::pipeline {
             out.payload_len = payload_len_;
             out.data.resize(policy_.N);
             out.was_recovered.assign(policy_.N, false);
-
-            // Copy present data payloads
+            out.delivered.assign(policy_.N, false);
             for (std::uint16_t i = 0; i < policy_.N; ++i) {
-                out.data[i] = data_[i]; // may be empty if missing
+                if (!seen(i)) continue; // empty if lost
+                if (delivered(i)) { out.delivered[i] = true; continue; }
+                out.data[i].assign(row(i), row(i) + len(i));
+                out.was_recovered[i] = recovered(i);
+            }
+            return out;
+        }
+
+        // Same result without copies: the lease takes the slab (the block is left empty) and
+        // gives it back to pool when released.
+        RxBlockLease lease_closed(std::shared_ptr<RxSlabPool> pool) {
+            recover();
+            RxBlockLease out;
+            out.gen_ = gen_;
+            out.N_ = policy_.N;
+            out.K_ = policy_.K;
+            out.payload_len_ = payload_len_;
+            if (!slab_) return out;
+            out.stride_ = stride_;
+            out.head_ = head_;
+            out.mask_words_ = mask_words();
+            out.pool_ = std::move(pool);
+            out.slab_ = std::move(slab_);
+            return out;
+        }
+
+    private:
+        // Recovery at block width, straight into the missing data rows. Recovered frames are
+        // marked seen (and recovered) at their protected length when the block carried one,
+        // else at the block width. A second call finds nothing missing.
+        void recover() {
+            if (!slab_) return;
+
+            // --- 2D XOR: iterative peeling over the line syndromes ---
+            if (syn_scheme_ == static_cast<std::uint8_t>(ltfec::protocol::fec_scheme_id::xor_2d)) {
+                std::vector<std::uint8_t> missing(policy_.N, 0);
+                bool any = false;
+                for (std::uint16_t i = 0; i < policy_.N; ++i) {
+                    missing[i] = !seen(i);
+                    any = any || missing[i];
+                }
+                if (!any) return;
+
+                // Peeling updates syndromes in place; work on copies of the available lines.
+                std::vector<std::vector<std::byte>> lines(policy_.K);
+                std::vector<std::byte*> rows(policy_.K, nullptr);
+                for (std::uint16_t j = 0; j < policy_.K; ++j) {
+                    if (!parity_usable(j)) continue;
+                    lines[j].assign(syn(j), syn(j) + payload_len_);
+                    rows[j] = lines[j].data();
+                }
+                std::vector<std::byte*> out_ptrs(policy_.N, nullptr);
+                for (std::uint16_t i = 0; i < policy_.N; ++i) {
+                    if (missing[i]) out_ptrs[i] = recovery_row(i);
+                }
+                ltfec::fec_core::xor2d_peel(std::span<std::byte* const>(rows.data(), rows.size()), payload_len_, columns_,
+                    std::span<std::uint8_t>(missing.data(), missing.size()),
+                    std::span<std::byte* const>(out_ptrs.data(), out_ptrs.size()));
+                for (std::uint16_t i = 0; i < policy_.N; ++i) {
+                    if (out_ptrs[i] && !missing[i]) mark_recovered(i); // still missing: not recoverable
+                }
+                return;
             }
 
+            // --- Fast path: solve the m×m system against the running syndromes ---
+            if (syn_scheme_ != 0) {
+                std::vector<std::uint16_t> miss;
+                for (std::uint16_t i = 0; i < policy_.N; ++i) {
+                    if (!seen(i)) miss.push_back(i);
+                }
+                if (!miss.empty() && miss.size() <= policy_.K) {
+                    std::vector<const std::byte*> rows(policy_.K, nullptr);
+                    for (std::uint16_t j = 0; j < policy_.K; ++j) {
+                        if (parity_usable(j)) rows[j] = syn(j);
+                    }
+                    std::vector<std::byte*> out_ptrs(miss.size());
+                    for (std::size_t i = 0; i < miss.size(); ++i) out_ptrs[i] = recovery_row(miss[i]);
+
+                    const auto syn_rows = std::span<const std::byte* const>(rows.data(), rows.size());
+                    const auto miss_idx = std::span<const std::uint16_t>(miss.data(), miss.size());
+                    const auto outs = std::span<std::byte*>(out_ptrs.data(), out_ptrs.size());
+                    const bool ok = (syn_scheme_ == static_cast<std::uint8_t>(ltfec::protocol::fec_scheme_id::cauchy_gf65536))
+                        ? ltfec::fec_core::gf65536_recover_from_syndromes(&ltfec::fec_core::gf65536_cauchy_coef,
+                            syn_rows, payload_len_, miss_idx, outs)
+                        : ltfec::fec_core::gf256_recover_from_syndromes(coef_for(syn_scheme_),
+                            syn_rows, payload_len_, miss_idx, outs);
+                    if (ok)
+                    {
+                        for (const std::uint16_t idx : miss) mark_recovered(idx);
+                    }
+                }
+                return;
+            }
+
+            const bool cauchy = scheme_ == static_cast<std::uint8_t>(ltfec::protocol::fec_scheme_id::cauchy_gf256) ||
+                scheme_ == static_cast<std::uint8_t>(ltfec::protocol::fec_scheme_id::cauchy_gf65536);
+
             // --- K=1 XOR recovery (existing path) ---
-            if (policy_.K == 1 && state_.recoverable_k1() && parity_.size() >= 1 &&
-                parity_[0].size() == payload_len_)
+            if (!cauchy && policy_.K == 1 && data_seen() + 1 == policy_.N && parity_usable(0))
             {
                 std::vector<const std::byte*> ptrs(policy_.N, nullptr);
                 int missing = -1;
                 for (std::uint16_t i = 0; i < policy_.N; ++i) {
-                    if (data_[i].size() == payload_len_) ptrs[i] = data_[i].data();
+                    if (seen(i)) ptrs[i] = row(i);
                     else {
                         if (missing != -1) { missing = -1; break; }
                         missing = static_cast<int>(i);
                     }
                 }
                 if (missing >= 0) {
-                    std::vector<std::byte> rec(payload_len_);
                     const int idx = ltfec::fec_core::block_xor_recover_one(
                         std::span<const std::byte* const>(ptrs.data(), ptrs.size()),
                         payload_len_,
-                        std::span<const std::byte>(parity_[0].data(), parity_[0].size()),
-                        std::span<std::byte>(rec.data(), rec.size()));
-                    if (idx == missing) {
-                        out.data[static_cast<std::size_t>(idx)] = std::move(rec);
-                        out.was_recovered[static_cast<std::size_t>(idx)] = true;
-                    }
+                        std::span<const std::byte>(row(policy_.N), payload_len_),
+                        std::span<std::byte>(recovery_row(static_cast<std::size_t>(missing)), payload_len_));
+                    if (idx == missing) mark_recovered(static_cast<std::size_t>(idx));
                 }
-                return out;
+                return;
             }
 
-            // --- K >= 2 GF(256) recovery: recover up to K missing if enough parity rows arrived ---
-            if (policy_.K >= 2) {
+            // --- GF(256) / GF(2^16) recovery (Vandermonde K >= 2, or Cauchy any K): recover up to K missing
+            //     if enough parity rows arrived ---
+            if (policy_.K >= 2 || (cauchy && policy_.K >= 1)) {
                 // Gather missing indices
                 std::vector<std::uint16_t> miss;
                 for (std::uint16_t i = 0; i < policy_.N; ++i) {
-                    if (data_[i].size() != payload_len_) miss.push_back(i);
+                    if (!seen(i)) miss.push_back(i);
                 }
                 if (!miss.empty() && miss.size() <= policy_.K) {
                     // Prepare pointers
                     std::vector<const std::byte*> data_ptrs(policy_.N, nullptr);
                     for (std::uint16_t i = 0; i < policy_.N; ++i) {
-                        if (data_[i].size() == payload_len_) data_ptrs[i] = data_[i].data();
+                        if (seen(i)) data_ptrs[i] = row(i);
                     }
                     std::vector<const std::byte*> parity_ptrs(policy_.K, nullptr);
                     for (std::uint16_t j = 0; j < policy_.K; ++j) {
-                        if (parity_[j].size() == payload_len_) parity_ptrs[j] = parity_[j].data();
+                        if (parity_usable(j)) parity_ptrs[j] = row(policy_.N + std::size_t{ j });
                     }
-                    std::vector<std::vector<std::byte>> recs(miss.size(), std::vector<std::byte>(payload_len_));
                     std::vector<std::byte*> out_ptrs(miss.size());
-                    for (std::size_t i = 0; i < miss.size(); ++i) out_ptrs[i] = recs[i].data();
+                    for (std::size_t i = 0; i < miss.size(); ++i) out_ptrs[i] = recovery_row(miss[i]);
 
-                    if (ltfec::fec_core::gf256_recover_erasures_vandermonde(
+                    const bool wide = scheme_ == static_cast<std::uint8_t>(ltfec::protocol::fec_scheme_id::cauchy_gf65536);
+                    const auto recover = wide ? &ltfec::fec_core::gf65536_cauchy_recover
+                                       : cauchy ? &ltfec::fec_core::gf256_cauchy_recover
+                                                : &ltfec::fec_core::gf256_recover_erasures_vandermonde;
+                    if (recover(
                         std::span<const std::byte* const>(data_ptrs.data(), data_ptrs.size()),
                         std::span<const std::byte* const>(parity_ptrs.data(), parity_ptrs.size()),
                         payload_len_,
                         std::span<const std::uint16_t>(miss.data(), miss.size()),
                         std::span<std::byte*>(out_ptrs.data(), out_ptrs.size())))
                     {
-                        // Success: move recovered payloads into outputs
-                        for (std::size_t k = 0; k < miss.size(); ++k) {
-                            const auto idx = static_cast<std::size_t>(miss[k]);
-                            out.data[idx] = std::move(recs[k]);
-                            out.was_recovered[idx] = true;
-                        }
+                        for (const std::uint16_t idx : miss) mark_recovered(idx);
                     }
                 }
             }
+        }
 
-            return out;
+        // ---- Slab layout ----
+        static std::size_t align_up(std::size_t v) noexcept {
+            return (v + RxSlabPool::kAlign - 1) & ~(RxSlabPool::kAlign - 1);
+        }
+        std::size_t frames() const noexcept { return std::size_t{ policy_.N } + policy_.K; }
+        std::size_t mask_words() const noexcept { return (frames() + 63) / 64; }
+        std::size_t slab_bytes(std::size_t stride) const noexcept { return head_ + (frames() + policy_.K) * stride; }
+        static std::size_t head_bytes(std::size_t mask_words, std::size_t frames) noexcept {
+            return align_up(8 * RxBlockLease::kMasks * mask_words + 2 * frames);
         }
 
+        RxSlabPool::Slab acquire(std::size_t bytes) {
+            return pool_ ? pool_->acquire(bytes) : RxSlabPool::allocate(bytes);
+        }
+
+        const std::uint64_t* mask() const noexcept { return reinterpret_cast<const std::uint64_t*>(slab_.data()); }
+        std::uint64_t* mask() noexcept { return reinterpret_cast<std::uint64_t*>(slab_.data()); }
+        std::uint64_t* recovered_mask() noexcept { return mask() + mask_words(); }
+        std::uint64_t* delivered_mask() noexcept { return mask() + 2 * mask_words(); }
+        std::size_t lengths_off() const noexcept { return 8 * RxBlockLease::kMasks * mask_words(); }
+        const std::uint16_t* lengths() const noexcept { return reinterpret_cast<const std::uint16_t*>(slab_.data() + lengths_off()); }
+        std::uint16_t* lengths() noexcept { return reinterpret_cast<std::uint16_t*>(slab_.data() + lengths_off()); }
+        const std::byte* row(std::size_t r) const noexcept { return slab_.data() + head_ + r * stride_; }
+        std::byte* row(std::size_t r) noexcept { return slab_.data() + head_ + r * stride_; }
+        const std::byte* syn(std::size_t j) const noexcept { return row(frames() + j); }
+        std::byte* syn(std::size_t j) noexcept { return row(frames() + j); }
+
+        bool seen(std::size_t f) const noexcept { return slab_ && ((mask()[f >> 6] >> (f & 63)) & 1u); }
+        void mark(std::size_t f) noexcept { mask()[f >> 6] |= std::uint64_t{ 1 } << (f & 63); }
+        void unmark(std::size_t f) noexcept { mask()[f >> 6] &= ~(std::uint64_t{ 1 } << (f & 63)); }
+        bool recovered(std::size_t i) const noexcept { return (mask()[mask_words() + (i >> 6)] >> (i & 63)) & 1u; }
+        bool delivered(std::size_t i) const noexcept { return (mask()[2 * mask_words() + (i >> 6)] >> (i & 63)) & 1u; }
+        std::uint16_t len(std::size_t f) const noexcept { return lengths()[f]; }
+        std::span<const std::byte> frame(std::size_t f) const noexcept { return std::span<const std::byte>(row(f), len(f)); }
+
+        // Set bits in [lo, hi).
+        std::uint16_t count_seen(std::size_t lo, std::size_t hi) const noexcept {
+            if (!slab_ || lo >= hi) return 0;
+            const std::uint64_t* m = mask();
+            std::size_t n = 0;
+            for (std::size_t w = lo >> 6; w <= (hi - 1) >> 6; ++w) {
+                std::uint64_t bits = m[w];
+                if (w == lo >> 6) bits &= ~std::uint64_t{ 0 } << (lo & 63);
+                if (w == (hi - 1) >> 6 && (hi & 63)) bits &= ~(~std::uint64_t{ 0 } << (hi & 63));
+                n += static_cast<std::size_t>(std::popcount(bits));
+            }
+            return static_cast<std::uint16_t>(n);
+        }
+        std::uint16_t data_seen() const noexcept { return count_seen(0, policy_.N); }
+        std::uint16_t parity_seen() const noexcept { return count_seen(policy_.N, frames()); }
+
+        // Parity row j arrived and is at block width.
+        bool parity_usable(std::size_t j) const noexcept {
+            const std::size_t f = policy_.N + j;
+            return seen(f) && len(f) == payload_len_;
+        }
+
+        // Frame f into its row, zero-padded to the stride.
+        void store(std::size_t f, std::span<const std::byte> payload) noexcept {
+            std::byte* r = row(f);
+            std::memcpy(r, payload.data(), payload.size());
+            std::memset(r + payload.size(), 0, stride_ - payload.size());
+            lengths()[f] = static_cast<std::uint16_t>(payload.size());
+            mark(f);
+        }
+
+        // Data row i cleared for a recovery routine to write into.
+        std::byte* recovery_row(std::size_t i) noexcept {
+            std::memset(row(i), 0, stride_);
+            return row(i);
+        }
+
+        void mark_recovered(std::size_t i) noexcept {
+            const bool cut = i < lens_.size() && lens_[i] != 0 && lens_[i] < payload_len_;
+            lengths()[i] = cut ? lens_[i] : payload_len_;
+            mark(i);
+            recovered_mask()[i >> 6] |= std::uint64_t{ 1 } << (i & 63);
+        }
+
+        // Move to a slab with rows of at least width bytes (only when a block outgrows the width
+        // its first frame suggested).
+        bool grow(std::size_t width) {
+            const std::size_t stride = align_up(std::max(width, 2 * stride_));
+            RxSlabPool::Slab next = acquire(slab_bytes(stride));
+            if (!next) return false;
+            std::byte* base = next.data();
+            std::memcpy(base, slab_.data(), head_);
+            for (std::size_t r = 0; r < frames() + policy_.K; ++r) {
+                std::byte* dst = base + head_ + r * stride;
+                const std::size_t keep = r < frames() ? (seen(r) ? len(r) : 0) : stride_;
+                std::memcpy(dst, row(r), keep);
+                std::memset(dst + keep, 0, stride - keep);
+            }
+            release_storage();
+            slab_ = std::move(next);
+            stride_ = stride;
+            return true;
+        }
+
+        // Admit a frame of len bytes against the block width (see ingest).
+        bool fit_width(std::size_t len, bool parity) {
+            if (width_fixed_) return parity ? len == payload_len_ : len <= payload_len_;
+            if (!parity && is_wide()) len = (len + 1) & ~static_cast<std::size_t>(1); // whole GF(2^16) symbols
+            if (len > stride_ && !grow(len)) return false;
+            if (len > payload_len_) {
+                payload_len_ = static_cast<std::uint16_t>(len); // syndrome rows are zero beyond the old width
+            }
+            else if (parity && len < payload_len_) {
+                return false; // narrower than data already seen
+            }
+            if (parity) width_fixed_ = true;
+            return true;
+        }
+
+        bool is_wide() const noexcept {
+            return syn_scheme_ == static_cast<std::uint8_t>(ltfec::protocol::fec_scheme_id::cauchy_gf65536);
+        }
+
+        static std::uint8_t xor_coef(std::size_t j, std::size_t) noexcept { return j == 0 ? 1 : 0; }
+
+        static ltfec::fec_core::Gf256CoefFn coef_for(std::uint8_t scheme) noexcept {
+            switch (static_cast<ltfec::protocol::fec_scheme_id>(scheme)) {
+            case ltfec::protocol::fec_scheme_id::xor_k1:       return &xor_coef;
+            case ltfec::protocol::fec_scheme_id::cauchy_gf256: return &ltfec::fec_core::cauchy_coef;
+            default:                                           return &ltfec::fec_core::vandermonde_coef;
+            }
+        }
+
+        // Fold data frame d into every syndrome row it takes part in.
+        void fold_data(std::uint16_t d, std::span<const std::byte> payload) noexcept {
+            if (syn_scheme_ == static_cast<std::uint8_t>(ltfec::protocol::fec_scheme_id::xor_2d)) {
+                // Member of exactly one column and one row line.
+                fold_syndrome(d % columns_, 1, payload);
+                fold_syndrome(columns_ + d / columns_, 1, payload);
+            }
+            else if (syn_scheme_ == static_cast<std::uint8_t>(ltfec::protocol::fec_scheme_id::cauchy_gf65536)) {
+                for (std::uint16_t j = 0; j < policy_.K; ++j) {
+                    fold_syndrome(j, ltfec::fec_core::gf65536_cauchy_coef(j, d), payload);
+                }
+            }
+            else {
+                const auto coef = coef_for(syn_scheme_);
+                for (std::uint16_t j = 0; j < policy_.K; ++j) {
+                    fold_syndrome(j, coef(j, d), payload);
+                }
+            }
+        }
+
+        // c is a GF(2^16) coefficient for cauchy_gf65536 blocks, a GF(256) one otherwise.
+        void fold_syndrome(std::size_t j, std::uint16_t c, std::span<const std::byte> payload) noexcept {
+            if (syn_scheme_ == 0 || j >= policy_.K || payload.size() > payload_len_) return;
+            if (is_wide()) {
+                if (payload.size() + (payload.size() & 1u) > payload_len_) return;
+                ltfec::fec_core::gf65536_mul_add_padded(syn(j), payload.data(), c, payload.size());
+                return;
+            }
+            ltfec::fec_core::gf256_mul_add_region(syn(j), payload.data(), static_cast<std::uint8_t>(c), payload.size());
+        }
 
-    private:
-        std::uint32_t gen_{ 0 };
         BlockPolicy policy_;
-        BlockState state_;
-        BlockTracker tracker_;
-        std::uint16_t payload_len_{ 0 };
+        std::uint32_t gen_{ 0 };
+        std::uint16_t payload_len_{ 0 };            // block width
+        bool width_fixed_{ false };                 // set by the first parity frame
+        std::vector<std::uint16_t> lens_;           // [N] protected lengths (varlen blocks only)
+        std::uint8_t scheme_{ 0 }; // from the first parity subheader; 0 = none seen yet
 
         bool started_{ false };
         std::uint64_t start_ms_{ 0 }, last_ms_{ 0 };
 
-        std::vector<std::vector<std::byte>> data_;   // [N][payload_len]
-        std::vector<std::vector<std::byte>> parity_; // [K][payload_len]
+        RxSlabPool* pool_{ nullptr };
+        RxSlabPool::Slab slab_;                      // see class comment
+        std::size_t stride_{ 0 };                    // row size, multiple of 64 and >= payload_len_
+        std::size_t head_{ 0 };                      // bitmask + lengths, padded
+        std::vector<std::optional<std::uint32_t>> data_crc_;   // [N] CRC trailer still to check (lazy CRC)
+        std::vector<std::optional<std::uint32_t>> parity_crc_; // [K]
+
+        // Running syndromes (see ingest) in the slab's last K rows; syn_scheme_ == 0 disables them.
+        std::uint8_t syn_scheme_{ 0 };
+        std::uint8_t columns_{ 0 };                  // 2D XOR only
     };
 
+    // Open blocks by generation. Generation ids are sequential per sender, so the blocks near the
+    // newest one sit in a ring of preallocated slots indexed by gen modulo the window (no hashing,
+    // and a slot's buffers are reused by the generation that lands on it next). Generations that
+    // fall outside the window, and open blocks pushed out of it by newer ones, go to an overflow
+    // map. Generations are ordered by serial-number arithmetic, so a 32-bit wrap is seamless.
+    //
+    // Closing: every block is put on a hashed timer wheel at its close deadline when it opens, and
+    // on a ready list when the fast path (all data + parity) is reached, so poll() only touches
+    // blocks that are due. Entries of blocks closed some other way go stale and are skipped.
     class RxBlockTable {
     public:
-        explicit RxBlockTable(RxConfig cfg) : cfg_(cfg) {}
+        // The pool keeps about two slabs per ring slot (a block that grows holds two briefly).
+        explicit RxBlockTable(RxConfig cfg)
+            : cfg_(cfg), pool_(std::make_shared<RxSlabPool>(2 * ring_slots(cfg))), wheel_(kWheelSlots) {
+            const std::size_t w = ring_slots(cfg);
+            ring_.reserve(w);
+            for (std::size_t i = 0; i < w; ++i) ring_.push_back(Slot{ false, 0, false, RxBlock(0, 0, 0, 0, cfg_, 0, pool_.get()) });
+        }
 
-        // Ingest a decoded frame; creates the block if needed.
+        // Ingest a decoded frame whose CRC has already been checked; creates the block if needed.
         bool ingest(std::uint64_t now_ms,
             const ltfec::protocol::BaseHeader& h,
             bool has_parity_sub,
             const ltfec::protocol::ParitySubheader& ps,
             std::span<const std::byte> payload)
         {
+            return ingest_frame(now_ms, h, has_parity_sub, ps, payload, std::nullopt, kNoDelivery);
+        }
+
+        // Same, with the frame's CRC32C trailer still unchecked (see RxConfig::lazy_crc).
+        // Returns false for a corrupt frame when the check happens here.
+        bool ingest(std::uint64_t now_ms,
+            const ltfec::protocol::BaseHeader& h,
+            bool has_parity_sub,
+            const ltfec::protocol::ParitySubheader& ps,
+            std::span<const std::byte> payload,
+            std::uint32_t crc)
+        {
+            return ingest_checked(now_ms, h, has_parity_sub, ps, payload, crc, kNoDelivery);
+        }
+
+        // Pass-through delivery: a data frame seen for the first time is handed to
+        // on_data(const RxDataFrame&) right away instead of waiting for its block to close, so
+        // frames that were never lost get no FEC latency. Duplicates are not delivered twice.
+        // At close, an RxClosedBlock carries only what was not delivered yet (recovered frames,
+        // flagged was_recovered) and marks the delivered indices in its delivered vector, so they
+        // are not mistaken for losses. An RxBlockLease still views every frame, delivered ones
+        // included, and flags them with delivered(i).
+        template <class OnData>
+            requires std::is_invocable_v<OnData&, const RxDataFrame&>
+        bool ingest(std::uint64_t now_ms,
+            const ltfec::protocol::BaseHeader& h,
+            bool has_parity_sub,
+            const ltfec::protocol::ParitySubheader& ps,
+            std::span<const std::byte> payload,
+            OnData&& on_data)
+        {
+            return ingest_frame(now_ms, h, has_parity_sub, ps, payload, std::nullopt, &on_data);
+        }
+
+        // Same, with the CRC32C trailer. Data frames are checked before they are delivered even
+        // with lazy_crc; parity frames stay lazy.
+        template <class OnData>
+            requires std::is_invocable_v<OnData&, const RxDataFrame&>
+        bool ingest(std::uint64_t now_ms,
+            const ltfec::protocol::BaseHeader& h,
+            bool has_parity_sub,
+            const ltfec::protocol::ParitySubheader& ps,
+            std::span<const std::byte> payload,
+            std::uint32_t crc,
+            OnData&& on_data)
+        {
+            return ingest_checked(now_ms, h, has_parity_sub, ps, payload, crc, &on_data);
+        }
+
+        bool should_close(std::uint32_t gen, std::uint64_t now_ms) const {
+            const Slot* s = find(gen);
+            return s && s->block.should_close(now_ms);
+        }
+
+        // If the block is ready to close, extract it (with recovery where possible) and erase from table.
+        bool close_if_ready(std::uint32_t gen, std::uint64_t now_ms, RxClosedBlock& out) {
+            Slot* s = find(gen);
+            if (!s || !s->block.should_close(now_ms)) return false;
+            out = close(*s);
+            return true;
+        }
+
+        // Same, handing out the block's storage instead of a copy (see RxBlockLease).
+        bool close_if_ready(std::uint32_t gen, std::uint64_t now_ms, RxBlockLease& out) {
+            Slot* s = find(gen);
+            if (!s || !s->block.should_close(now_ms)) return false;
+            out = lease(*s);
+            return true;
+        }
+
+        // Close every block that is due at now_ms: fast-path blocks first (in the order they
+        // completed), then those whose deadline has passed. on_closed is called once per block,
+        // with an RxBlockLease&& if it accepts one (no copies), else an RxClosedBlock&&. Returns
+        // the number closed. Cost is proportional to the blocks closed
+        // plus the wheel slots elapsed since the previous poll, not to the blocks open.
+        template <class OnClosed>
+        std::size_t poll(std::uint64_t now_ms, OnClosed&& on_closed) {
+            std::size_t closed = 0;
+
+            // Swap out first: the callback may ingest and complete more blocks (next poll).
+            ready_scratch_.swap(ready_);
+            for (const Timer& t : ready_scratch_) {
+                Slot* s = live(t);
+                if (!s) continue;
+                emit(*s, on_closed);
+                ++closed;
+            }
+            ready_scratch_.clear();
+
+            const std::uint64_t tick = now_ms / kTickMs;
+            if (!wheel_started_) { wheel_tick_ = tick; wheel_started_ = true; }
+            // From the last polled tick (its slot may hold later deadlines of the same tick) up to
+            // now; one full turn visits every slot.
+            const std::uint64_t steps = tick >= wheel_tick_ ? std::min<std::uint64_t>(tick - wheel_tick_ + 1, kWheelSlots) : 1;
+            for (std::uint64_t k = 0; k < steps; ++k) {
+                auto& bucket = wheel_[(wheel_tick_ + k) % kWheelSlots];
+                for (std::size_t i = 0; i < bucket.size();) {
+                    const Timer t = bucket[i];
+                    Slot* s = live(t);
+                    if (s && t.deadline_ms > now_ms) { ++i; continue; } // a later turn of the wheel
+                    bucket[i] = bucket.back();
+                    bucket.pop_back();
+                    if (!s) continue;
+                    emit(*s, on_closed);
+                    ++closed;
+                }
+            }
+            if (tick > wheel_tick_) wheel_tick_ = tick;
+            return closed;
+        }
+
+        // Blocks currently open (about interleave_depth in steady state).
+        std::size_t open_blocks() const noexcept { return ring_open_ + overflow_.size(); }
+        // Of those, blocks held in the overflow map rather than the ring.
+        std::size_t overflow_blocks() const noexcept { return overflow_.size(); }
+        std::size_t ring_size() const noexcept { return ring_.size(); }
+        // Frame storage of the open blocks (closed blocks hand their slab back).
+        const RxSlabPool& pool() const noexcept { return *pool_; }
+
+        std::optional<RxSnapshot> snapshot(std::uint32_t gen) const {
+            const Slot* s = find(gen);
+            if (!s) return std::nullopt;
+            return s->block.snapshot();
+        }
+
+    private:
+        static constexpr void (*kNoDelivery)(const RxDataFrame&) = nullptr;
+
+        // on_data: pass-through callback, or kNoDelivery.
+        template <class OnData>
+        bool ingest_checked(std::uint64_t now_ms,
+            const ltfec::protocol::BaseHeader& h,
+            bool has_parity_sub,
+            const ltfec::protocol::ParitySubheader& ps,
+            std::span<const std::byte> payload,
+            std::uint32_t crc,
+            OnData* on_data)
+        {
+            // The varlen length table is used on arrival, so such parity frames are checked now;
+            // so are data frames that are delivered on arrival.
+            const bool eager = !cfg_.lazy_crc || (has_parity_sub && (h.flags1 & ltfec::protocol::k_flags1_varlen)) ||
+                (on_data && !has_parity_sub);
+            if (eager) {
+                if (ltfec::util::crc32c(payload) != crc) return false;
+                return ingest_frame(now_ms, h, has_parity_sub, ps, payload, std::nullopt, on_data);
+            }
+            return ingest_frame(now_ms, h, has_parity_sub, ps, payload, crc, on_data);
+        }
+
+        template <class OnData>
+        bool ingest_frame(std::uint64_t now_ms,
+            const ltfec::protocol::BaseHeader& h,
+            bool has_parity_sub,
+            const ltfec::protocol::ParitySubheader& ps,
+            std::span<const std::byte> payload,
+            std::optional<std::uint32_t> crc,
+            OnData* on_data)
+        {
+            // Variable-length blocks: split the length table off the parity payload.
+            std::span<const std::byte> lengths;
+            if (has_parity_sub && (h.flags1 & ltfec::protocol::k_flags1_varlen)) {
+                const std::size_t tbl = ltfec::protocol::length_table_size(h.flags1, h.data_count);
+                if (payload.size() <= tbl) return false;
+                lengths = payload.last(tbl);
+                payload = payload.first(payload.size() - tbl);
+            }
             if (payload.empty()) return false;
-            if (cfg_.max_payload_len && payload.size() > cfg_.max_payload_len) return false;
+            // Parity may be one byte wider than any data frame (GF(2^16) symbol padding).
+            if (cfg_.max_payload_len && payload.size() > cfg_.max_payload_len + (has_parity_sub ? 1u : 0u)) return false;
             const auto key = h.fec_gen_id;
 
-            auto it = blocks_.find(key);
-            if (it == blocks_.end()) {
-                RxBlock blk(key, h.data_count, h.parity_count, static_cast<std::uint16_t>(payload.size()), cfg_);
-                auto [ins_it, ok] = blocks_.emplace(key, std::move(blk));
-                it = ins_it;
-            }
-            else {
-                if (it->second.payload_len() != payload.size()) return false;
+            Slot* s = find(key);
+            const bool opened = (s == nullptr);
+            if (opened) {
+                s = &create(key, h.data_count, h.parity_count, static_cast<std::uint16_t>(payload.size()),
+                    ltfec::protocol::flags2_get_columns(h.flags2));
             }
+            RxBlock& blk = s->block;
+            if (!lengths.empty()) blk.note_lengths(lengths);
 
             if (has_parity_sub) {
-                it->second.ingest(now_ms, /*is_parity*/true, /*seq*/0, ps.fec_parity_index, payload);
+                blk.ingest(now_ms, /*is_parity*/true, /*seq*/0, ps.fec_parity_index, payload, ps.fec_scheme_id, crc);
             }
-            else {
-                it->second.ingest(now_ms, /*is_parity*/false, h.seq_in_block, 0, payload);
+            else if (blk.ingest(now_ms, /*is_parity*/false, h.seq_in_block, 0, payload, 0, crc) && on_data) {
+                (*on_data)(RxDataFrame{ key, h.seq_in_block, payload });
+                blk.mark_delivered(h.seq_in_block);
+            }
+
+            // The first frame starts the block's clock, which fixes its deadline.
+            if (opened) {
+                if (!wheel_started_) { wheel_tick_ = now_ms / kTickMs; wheel_started_ = true; }
+                // A deadline behind the cursor goes into the cursor's bucket, the next one polled.
+                const std::uint64_t deadline = blk.deadline_ms();
+                const std::uint64_t tick = std::max(deadline / kTickMs, wheel_tick_);
+                wheel_[tick % kWheelSlots].push_back(Timer{ key, s->serial, deadline });
+            }
+            if (!s->ready && blk.complete()) {
+                s->ready = true;
+                ready_.push_back(Timer{ key, s->serial, now_ms });
             }
             return true;
         }
 
-        bool should_close(std::uint32_t gen, std::uint64_t now_ms) const {
-            auto it = blocks_.find(gen);
-            if (it == blocks_.end()) return false;
-            return it->second.should_close(now_ms);
+        // A generation this far behind the newest is not a late frame but a new start (sender
+        // restart, or the 16-bit generation of v2 headers wrapping): the window moves back to it.
+        static constexpr std::uint32_t kResyncGap = 0x8000u;
+
+        // Timer wheel: kWheelSlots buckets of kTickMs each (about a second per turn; later
+        // deadlines just stay in their bucket for another turn).
+        static constexpr std::uint64_t kTickMs = 4;
+        static constexpr std::size_t kWheelSlots = 256;
+
+        struct Slot {
+            bool used{ false };
+            std::uint64_t serial{ 0 };  // distinguishes successive blocks of one generation id
+            bool ready{ false };        // already on ready_
+            RxBlock block;
+        };
+
+        struct Timer {
+            std::uint32_t gen{ 0 };
+            std::uint64_t serial{ 0 };
+            std::uint64_t deadline_ms{ 0 };
+        };
+
+        static std::size_t ring_slots(const RxConfig& cfg) noexcept {
+            const std::size_t want = std::max<std::size_t>(cfg.gen_window, 4u * std::max<std::uint16_t>(cfg.interleave_depth, 1));
+            std::size_t w = 1;
+            while (w < want) w <<= 1;
+            return w;
         }
 
-        // If the block is ready to close, extract it (with recovery where possible) and erase from table.
-        bool close_if_ready(std::uint32_t gen, std::uint64_t now_ms, RxClosedBlock& out) {
-            auto it = blocks_.find(gen);
-            if (it == blocks_.end()) return false;
-            if (!it->second.should_close(now_ms)) return false;
-            out = it->second.extract_closed();
-            blocks_.erase(it);
-            return true;
+        std::size_t slot_of(std::uint32_t gen) const noexcept { return gen & (ring_.size() - 1); }
+
+        const Slot* find(std::uint32_t gen) const {
+            const Slot& s = ring_[slot_of(gen)];
+            if (s.used && s.block.gen() == gen) return &s;
+            auto it = overflow_.find(gen);
+            return it == overflow_.end() ? nullptr : &it->second;
+        }
+        Slot* find(std::uint32_t gen) {
+            return const_cast<Slot*>(std::as_const(*this).find(gen));
         }
 
-        std::optional<RxSnapshot> snapshot(std::uint32_t gen) const {
-            auto it = blocks_.find(gen);
-            if (it == blocks_.end()) return std::nullopt;
-            return it->second.snapshot();
+        // The block a timer was set for, if it is still open.
+        Slot* live(const Timer& t) {
+            Slot* s = find(t.gen);
+            return (s && s->serial == t.serial) ? s : nullptr;
+        }
+
+        Slot& create(std::uint32_t gen, std::uint16_t N, std::uint16_t K, std::uint16_t payload_len, std::uint8_t columns) {
+            // Serial-number order: gen is newer than top_ if (gen - top_) is positive as an int32.
+            const std::uint32_t behind = top_ - gen;
+            if (!have_top_ || static_cast<std::int32_t>(behind) < 0 || behind >= kResyncGap) {
+                top_ = gen;
+                have_top_ = true;
+            }
+            Slot* s = nullptr;
+            if (top_ - gen < ring_.size()) {
+                s = &ring_[slot_of(gen)];
+                // Still held by an older generation, which is now outside the window: keep it open
+                // in the overflow map.
+                if (s->used) overflow_.emplace(s->block.gen(), std::move(*s));
+                else ++ring_open_;
+                s->block.reset(gen, N, K, payload_len, cfg_, columns);
+            }
+            else {
+                s = &overflow_.emplace(gen, Slot{ false, 0, false, RxBlock(gen, N, K, payload_len, cfg_, columns, pool_.get()) }).first->second;
+            }
+            s->used = true;
+            s->serial = ++serial_;
+            s->ready = false;
+            return *s;
+        }
+
+        RxClosedBlock close(Slot& s) {
+            const std::uint16_t corrupt = s.block.verify_pending();
+            RxClosedBlock out = s.block.extract_closed();
+            out.corrupt = corrupt;
+            s.block.release_storage();
+            release(s.block.gen());
+            return out;
+        }
+
+        RxBlockLease lease(Slot& s) {
+            const std::uint16_t corrupt = s.block.verify_pending();
+            RxBlockLease out = s.block.lease_closed(pool_);
+            out.corrupt_ = corrupt;
+            release(s.block.gen());
+            return out;
+        }
+
+        template <class OnClosed>
+        void emit(Slot& s, OnClosed& on_closed) {
+            if constexpr (std::is_invocable_v<OnClosed&, RxBlockLease&&>) on_closed(lease(s));
+            else on_closed(close(s));
+        }
+
+        void release(std::uint32_t gen) {
+            Slot& s = ring_[slot_of(gen)];
+            if (s.used && s.block.gen() == gen) {
+                s.used = false; // the slot is reused by the next generation that maps to it
+                --ring_open_;
+                return;
+            }
+            overflow_.erase(gen);
         }
 
-    private:
         RxConfig cfg_;
-        std::unordered_map<std::uint32_t, RxBlock> blocks_;
+        std::shared_ptr<RxSlabPool> pool_;                    // declared first: blocks release into it; shared with leases
+        std::vector<Slot> ring_;                              // power-of-two size, indexed by gen
+        std::size_t ring_open_{ 0 };
+        std::uint32_t top_{ 0 };                              // newest generation placed (serial order)
+        bool have_top_{ false };
+        std::uint64_t serial_{ 0 };
+        std::unordered_map<std::uint32_t, Slot> overflow_;    // out-of-window generations
+
+        std::vector<std::vector<Timer>> wheel_;               // [kWheelSlots] by deadline tick
+        std::uint64_t wheel_tick_{ 0 };                       // last tick polled
+        bool wheel_started_{ false };
+        std::vector<Timer> ready_;                            // fast-path completions since last poll
+        std::vector<Timer> ready_scratch_;
     };
 
 } // namespace ltfec::pipeline
\ No newline at end of file
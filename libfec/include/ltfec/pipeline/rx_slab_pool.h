@@ -0,0 +1,91 @@
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <utility>
+#include <vector>
+
+namespace ltfec::pipeline {
+
+    // Recycles the cache-line aligned buffers RX blocks keep their frames in. A receiver in steady
+    // state stops allocating once it has seen its largest blocks. The free list is capped in count
+    // and bytes: what a burst of extra generations or one huge block leaves behind beyond the cap
+    // is freed, not kept for good.
+    class RxSlabPool {
+    public:
+        static constexpr std::size_t kAlign = 64;
+        static constexpr std::size_t kDefaultMaxFree = 32;
+        static constexpr std::size_t kDefaultMaxFreeBytes = std::size_t{ 16 } << 20;
+
+        explicit RxSlabPool(std::size_t max_free = kDefaultMaxFree, std::size_t max_free_bytes = kDefaultMaxFreeBytes)
+            : max_free_(max_free), max_free_bytes_(max_free_bytes) {
+        }
+
+        struct AlignedDelete {
+            void operator()(std::byte* p) const noexcept { ::operator delete[](p, std::align_val_t{ kAlign }); }
+        };
+
+        // One buffer; empty (data() == nullptr) if the allocation failed.
+        class Slab {
+        public:
+            Slab() = default;
+            std::byte* data() const noexcept { return buf_.get(); }
+            std::size_t capacity() const noexcept { return cap_; }
+            explicit operator bool() const noexcept { return buf_ != nullptr; }
+
+        private:
+            friend class RxSlabPool;
+            std::unique_ptr<std::byte[], AlignedDelete> buf_;
+            std::size_t cap_{ 0 };
+        };
+
+        // The smallest free buffer of at least bytes, or a new one.
+        Slab acquire(std::size_t bytes) {
+            auto best = free_.end();
+            for (auto it = free_.begin(); it != free_.end(); ++it) {
+                if (it->cap_ >= bytes && (best == free_.end() || it->cap_ < best->cap_)) best = it;
+            }
+            if (best == free_.end()) {
+                Slab s = allocate(bytes);
+                if (s) ++allocations_;
+                return s;
+            }
+            std::iter_swap(best, free_.end() - 1);
+            Slab s = std::move(free_.back());
+            free_.pop_back();
+            free_bytes_ -= s.cap_;
+            return s;
+        }
+
+        // Keep s for reuse if the free list has room, else free it.
+        void release(Slab&& s) {
+            if (s && free_.size() < max_free_ && free_bytes_ + s.cap_ <= max_free_bytes_) {
+                free_bytes_ += s.cap_;
+                free_.push_back(std::move(s));
+            }
+            s = Slab{};
+        }
+
+        // A buffer outside any pool (blocks built without one).
+        static Slab allocate(std::size_t bytes) noexcept {
+            Slab s;
+            s.buf_.reset(static_cast<std::byte*>(::operator new[](bytes, std::align_val_t{ kAlign }, std::nothrow)));
+            if (s.buf_) s.cap_ = bytes;
+            return s;
+        }
+
+        std::size_t free_slabs() const noexcept { return free_.size(); }
+        std::size_t free_bytes() const noexcept { return free_bytes_; }
+        // Buffers allocated by acquire so far.
+        std::size_t allocations() const noexcept { return allocations_; }
+
+    private:
+        std::vector<Slab> free_;
+        std::size_t free_bytes_{ 0 };
+        std::size_t max_free_;
+        std::size_t max_free_bytes_;
+        std::size_t allocations_{ 0 };
+    };
+
+} // namespace ltfec::pipeline
\ No newline at end of file
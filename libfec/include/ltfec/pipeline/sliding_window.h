@@ -0,0 +1,112 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include <span>
+#include <ltfec/protocol/frame.h>
+#include <ltfec/protocol/frame_builder.h>
+
+// Sliding-window random linear code (fec_scheme_id::rlc_sliding), RFC 8681 style.
+//
+// Wire mapping (all frames carry protocol::k_flags1_sliding_window in flags1):
+//   source frame: fec_gen_id = source sequence number (ESI), seq_in_block = 0,
+//                 data_count = W, parity_count = 1.
+//   repair frame: fec_gen_id = first ESI covered, data_count = w (<= W sources covered),
+//                 seq_in_block = w, parity_count = 1, subheader {rlc_sliding, repair_key}.
+//                 payload = Σ_i c_i * source[first + i], c = rlc_coefficients(first, key).
+namespace ltfec::pipeline {
+
+    struct SlidingWindowConfig {
+        std::uint16_t W{ 16 };               // sources covered by each repair frame (1..kMaxWindow)
+        std::uint16_t R{ 4 };                // one repair frame after every R source frames
+        std::uint16_t max_payload_len{ 1300 };
+
+        static constexpr std::uint16_t kMaxWindow = 255;
+        bool valid() const noexcept { return W >= 1 && W <= kMaxWindow && R >= 1; }
+    };
+
+    // TX side: emits each source frame immediately and a repair frame every R sources.
+    // All payloads of a stream must have the length of the first one.
+    class SlidingWindowEncoder {
+    public:
+        explicit SlidingWindowEncoder(SlidingWindowConfig cfg, std::uint32_t first_esi = 0);
+
+        // OUT: out_frames holds the source frame, followed by a repair frame when one is due.
+        // Returns false (and emits nothing) if validation fails.
+        bool push_data(std::span<const std::byte> payload,
+            std::vector<std::vector<std::byte>>& out_frames) noexcept;
+
+        std::uint32_t next_esi() const noexcept { return next_esi_; }
+        const SlidingWindowConfig& config() const noexcept { return cfg_; }
+
+    private:
+        SlidingWindowConfig cfg_;
+        std::uint32_t next_esi_{ 0 };
+        std::uint64_t pushed_{ 0 };
+        std::uint16_t since_repair_{ 0 };
+        std::uint8_t repair_key_{ 0 };
+        std::size_t payload_len_{ 0 };                // 0 = not fixed yet
+        std::vector<std::vector<std::byte>> window_;  // [W], indexed by push count % W
+        std::vector<std::uint8_t> coefs_;             // [W]
+        std::vector<std::byte> repair_;               // [payload_len_]
+    };
+
+    // One source frame handed to the application.
+    struct RxSourceFrame {
+        std::uint32_t esi{ 0 };
+        std::vector<std::byte> payload;
+        bool was_recovered{ false };
+    };
+
+    // RX side: on-the-fly Gaussian elimination over the repair equations that still have
+    // unknown sources. Received sources are delivered immediately; lost ones as soon as
+    // enough independent repair frames covering them have arrived. Sources more than 2W
+    // behind the newest ESI are given up on.
+    class SlidingWindowDecoder {
+    public:
+        explicit SlidingWindowDecoder(SlidingWindowConfig cfg);
+
+        // Ingest a decoded frame; appends newly available sources (received or recovered) to out.
+        // Returns false if the frame does not belong to a sliding-window stream or is malformed.
+        bool ingest(const ltfec::protocol::BaseHeader& h,
+            bool has_parity_sub,
+            const ltfec::protocol::ParitySubheader& ps,
+            std::span<const std::byte> payload,
+            std::vector<RxSourceFrame>& out);
+
+        // Repair equations currently waiting for more frames.
+        std::size_t pending_equations() const noexcept { return rows_.size(); }
+
+    private:
+        struct Term { std::uint32_t esi; std::uint8_t coef; };
+        struct Row {
+            std::vector<Term> terms;     // sorted by ESI (serial order); terms[0] is the pivot
+            std::vector<std::byte> rhs;  // [payload_len_]
+        };
+        struct Slot {
+            std::uint32_t esi{ 0 };
+            bool valid{ false };
+            std::vector<std::byte> data;
+        };
+
+        bool in_horizon(std::uint32_t esi) const noexcept;
+        // Slot of an ESI within the horizon.
+        std::size_t slot_of(std::uint32_t esi) const noexcept;
+        const Slot* known(std::uint32_t esi) const noexcept;
+        void advance(std::uint32_t esi);
+        void store(std::uint32_t esi, std::span<const std::byte> payload, bool recovered, std::vector<RxSourceFrame>& out);
+        void substitute(std::uint32_t esi, std::span<const std::byte> value);
+        void insert(Row r);
+        void harvest(std::vector<RxSourceFrame>& out);
+        void axpy(Row& dst, const Row& src, std::uint8_t c) const;
+
+        SlidingWindowConfig cfg_;
+        std::size_t payload_len_{ 0 };
+        bool started_{ false };
+        std::uint32_t highest_{ 0 };
+        std::uint64_t top_{ 0 };    // highest_ without the 32-bit wrap
+        std::vector<Slot> slots_;   // [2W], indexed by unwrapped esi % 2W
+        std::vector<Row> rows_;     // reduced row echelon: pivots distinct, no row holds another's pivot
+    };
+
+} // namespace ltfec::pipeline
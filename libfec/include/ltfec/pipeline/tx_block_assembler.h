@@ -1,9 +1,12 @@
 ﻿#pragma once
+#include <array>
 #include <cstddef>
 #include <cstdint>
 #include <vector>
 #include <span>
 #include <chrono>
+#include <memory>
+#include <new>
 #include <ltfec/protocol/frame.h>
 #include <ltfec/protocol/frame_builder.h>
 #include <ltfec/pipeline/fec_encoder.h>
@@ -16,32 +19,179 @@ namespace ltfec::pipeline {
         std::uint16_t K{ 1 };
         // Optional limit to enforce (≈1200–1300B per DESIGN.md). 0 = no check.
         std::uint16_t max_payload_len{ 1300 };
+        // Parity scheme (protocol::fec_scheme_id); 0 = pick from K (see FecEncoderConfig).
+        std::uint8_t fec_scheme_id{ 0 };
+        // 2D XOR column count L (requires fec_scheme_id = xor_2d, N = L×D, K = L + D); 0 = unused.
+        std::uint8_t columns{ 0 };
+        // Interleave depth D for assemble_interleaved (1 = frames of one block go out back to back).
+        std::uint16_t interleave_depth{ 1 };
+        // Header format: k_protocol_version, or k_protocol_version_v2 for the compact header
+        // (payload_len implied by the datagram size). Blocks v2 cannot describe (N > 1024,
+        // K > 255, 2D XOR) still go out as v1.
+        std::uint8_t wire_version{ ltfec::protocol::k_protocol_version };
+    };
+
+    // Reusable output buffer for TxBlockAssembler::assemble_block: all N+K frames of a block back
+    // to back in one allocation, each starting on a cache line. The storage only grows, so a slab
+    // kept across blocks stops allocating once it has seen the largest block.
+    class TxFrameSlab {
+    public:
+        static constexpr std::size_t kAlign = 64;
+
+        struct Entry {
+            std::size_t offset{ 0 };  // from data(), multiple of kAlign
+            std::size_t size{ 0 };    // encoded datagram size
+        };
+
+        // Frames of the last assembled block, in wire order (N data, then K parity).
+        std::size_t frame_count() const noexcept { return frames_.size(); }
+        std::span<const std::byte> frame(std::size_t i) const noexcept {
+            return std::span<const std::byte>(buf_.get() + frames_[i].offset, frames_[i].size);
+        }
+        std::span<const Entry> offsets() const noexcept { return std::span<const Entry>(frames_.data(), frames_.size()); }
+        const std::byte* data() const noexcept { return buf_.get(); }
+        std::size_t capacity() const noexcept { return cap_; }
+
+    private:
+        friend class TxBlockAssembler;
+        bool reserve(std::size_t bytes) noexcept;
+
+        struct AlignedDelete {
+            void operator()(std::byte* p) const noexcept { ::operator delete[](p, std::align_val_t{ kAlign }); }
+        };
+        std::unique_ptr<std::byte[], AlignedDelete> buf_;
+        std::size_t cap_{ 0 };
+        std::vector<Entry> frames_;
+    };
+
+    // Header and CRC trailer of a data frame whose payload goes out straight from the caller's
+    // buffer (UdpSender::send_gather): the datagram is header ++ payload ++ trailer.
+    struct TxDataFrameParts {
+        std::array<std::byte, ltfec::protocol::FrameSizes::kBase> header{};
+        std::array<std::byte, ltfec::protocol::FrameSizes::kCrcTrailer> trailer{};
+        std::size_t header_len{ ltfec::protocol::FrameSizes::kBase };  // shorter for v2 headers
+
+        std::span<const std::byte> header_bytes() const noexcept { return std::span<const std::byte>(header.data(), header_len); }
     };
 
     // Assembles a full block into on-wire frames (N data + K parity).
-    // Requires all data payloads to be equal length.
+    // Data payloads may differ in length: data frames go out at their true size, parity covers
+    // them zero-padded to the block width and (k_flags1_varlen) carries the N lengths. The length
+    // table comes out of the width budget: a varlen block is at most max_payload_len - 2N wide
+    // (see parity_fits), so its parity frames are no larger than a fixed-length block's. Payloads
+    // that are all one length short of the width (odd lengths under GF(2^16)) carry just that
+    // length (k_flags1_common_len), so they fit at any N.
     class TxBlockAssembler {
     public:
         explicit TxBlockAssembler(TxConfig cfg, std::uint32_t gen_seed = default_seed())
-            : cfg_(cfg), enc_(FecEncoderConfig{ cfg.N, cfg.K, 0 }), next_gen_id_(gen_seed) {
+            : cfg_(cfg), enc_(FecEncoderConfig{ cfg.N, cfg.K, cfg.fec_scheme_id, cfg.columns }), next_gen_id_(gen_seed) {
         }
 
         // Builds frames for one block.
-        // IN:  data_payloads.size() == N, all same length.
+        // IN:  data_payloads.size() == N, each non-empty and <= max_payload_len.
         // OUT: out_frames resized to N+K; each entry is a full encoded datagram.
         // Returns true on success; false if validation fails.
         bool assemble_block(const std::vector<std::span<const std::byte>>& data_payloads,
             std::vector<std::vector<std::byte>>& out_frames) noexcept;
 
+        // Same, writing the frames into a caller-owned slab instead of N+K vectors. Parity is
+        // encoded directly in the parity frames' payload regions; with a warmed-up slab the only
+        // allocations left are inside the GF encoders.
+        bool assemble_block(std::span<const std::span<const std::byte>> data_payloads,
+            TxFrameSlab& out) noexcept;
+
+        // Interleaved assembly: builds D = interleave_depth consecutive blocks and emits their frames
+        // round-robin (frame i of every block before frame i+1 of any), so a burst of up to D
+        // consecutive wire losses costs each generation at most one frame.
+        // IN:  blocks.size() == D, each as for assemble_block.
+        // OUT: out_frames holds D*(N+K) datagrams in wire order.
+        bool assemble_interleaved(const std::vector<std::vector<std::span<const std::byte>>>& blocks,
+            std::vector<std::vector<std::byte>>& out_frames) noexcept;
+
+        // Incremental assembly: push the data payloads of a block one at a time, in order.
+        // Each push emits that data frame immediately and folds the payload into the K parity
+        // accumulators, so the parity frames are complete as soon as the Nth payload is pushed.
+        // OUT: out_frames holds the data frame; after the Nth push it also holds the K parity
+        //      frames (size 1+K), and the next push starts a new block.
+        // Payload lengths may vary within a block, as for assemble_block.
+        // Payloads are capped at max_push_len() from the first push of a block, so every payload up
+        // to it is accepted until the block completes.
+        // Returns false (and emits nothing) if validation fails; the partial block is kept.
+        bool push_data(std::span<const std::byte> payload,
+            std::vector<std::vector<std::byte>>& out_frames) noexcept;
+
+        // Scatter-gather variant: the data frame is not materialized, only its header and trailer
+        // (payload bytes are read for CRC and parity but never copied). out_parity is empty until
+        // the Nth push, then holds the K parity frames.
+        bool push_data(std::span<const std::byte> payload, TxDataFrameParts& data_frame,
+            std::vector<std::vector<std::byte>>& out_parity) noexcept;
+
+        // Longest payload push_data accepts: max_payload_len - 2N, since any block may turn varlen
+        // at its next push and the length table must still fit. Blocks too large for a table
+        // (2N >= max_payload_len) get max_payload_len, but every payload must then be as long as the first.
+        std::size_t max_push_len() const noexcept;
+
+        // Number of payloads pushed into the current incremental block (0..N-1).
+        std::uint16_t pushed_in_block() const noexcept { return pushed_; }
+
+        // Drop a partially pushed block (its generation id stays consumed).
+        void abandon_block() noexcept { pushed_ = 0; }
+
         // Expose the generation id that will be used next.
         std::uint32_t peek_next_gen() const noexcept { return next_gen_id_; }
 
-        // Helper to compute encoded frame size.
+        // Helper to compute encoded frame size (v1 header).
         static std::size_t encoded_size_for(std::size_t payload_len, bool parity) {
             return ltfec::protocol::encoded_size(payload_len, parity);
         }
 
     private:
+        std::uint8_t wire_columns() const noexcept;
+        // True when this block's frames carry the v2 header (TxConfig::wire_version).
+        bool compact_header() const noexcept;
+        std::size_t header_size() const noexcept;
+        std::size_t frame_size(std::size_t payload_len, bool parity) const noexcept;
+        bool write_header(std::span<std::byte> out, const ltfec::protocol::BaseHeader& h) const noexcept;
+        // True when parity is plain XOR and is folded in while the data frames are written.
+        bool fuses_parity() const noexcept;
+        // Parity frames of a block this wide fit: at most max_payload_len after protection
+        // (parity = width, plus the length table for varlen blocks) and in a u16.
+        bool parity_fits(std::size_t width, std::size_t table_len) const noexcept;
+        // Length table bytes for payloads of min_len..max_len in a block this wide: none if they
+        // all fill it, one common length if they are all equal, else all N.
+        std::size_t length_table_len(std::size_t width, std::size_t min_len, std::size_t max_len) const noexcept;
+        // Widest payload a varlen block may carry (0: not even one byte leaves room for the table).
+        std::size_t varlen_cap() const noexcept;
+        // Validate a block's payloads; width is the protected block width, table_len the bytes of
+        // length table its parity frames carry (0: fixed length).
+        bool block_width(std::span<const std::span<const std::byte>> data_payloads,
+            std::size_t& width, std::size_t& table_len) const noexcept;
+        // acc: XOR parity accumulator the payload is folded into (nullptr: none).
+        // crc_out: receives the frame's CRC32C (nullptr: not needed).
+        bool emit_data_frame(std::uint32_t gen, std::uint16_t index,
+            std::span<const std::byte> payload, std::byte* acc, std::uint32_t* crc_out,
+            std::vector<std::byte>& out) const noexcept;
+        bool write_data_frame(std::uint32_t gen, std::uint16_t index,
+            std::span<const std::byte> payload, std::byte* acc, std::uint32_t* crc_out,
+            std::span<std::byte> out) const noexcept;
+        // copy_to: where the payload goes (nullptr: nowhere, the caller sends it in place).
+        bool write_data_parts(std::uint32_t gen, std::uint16_t index,
+            std::span<const std::byte> payload, std::byte* copy_to, std::byte* acc, std::uint32_t* crc_out,
+            std::span<std::byte> header, std::span<std::byte> trailer) const noexcept;
+        bool push_impl(std::span<const std::byte> payload, TxDataFrameParts* parts,
+            std::vector<std::vector<std::byte>>& out_frames) noexcept;
+        // parity_crc: CRC32C of the parity bytes if already known (nullptr: computed here).
+        bool emit_parity_frame(std::uint32_t gen, std::uint16_t index, std::uint8_t scheme,
+            std::span<const std::byte> parity, std::span<const std::uint16_t> lengths,
+            const std::uint32_t* parity_crc, std::vector<std::byte>& out) const noexcept;
+        bool write_parity_frame(std::uint32_t gen, std::uint16_t index, std::uint8_t scheme,
+            std::span<const std::byte> parity, std::span<const std::uint16_t> lengths,
+            const std::uint32_t* parity_crc, std::span<std::byte> out) const noexcept;
+        // CRC32C of the XOR parity over a block, from the data CRCs (lengths empty: all equal width).
+        // Varlen blocks pad the CRCs in place.
+        static std::uint32_t xor_parity_crc(std::span<std::uint32_t> crcs,
+            std::span<const std::uint16_t> lengths, std::size_t width) noexcept;
+
         static std::uint32_t default_seed() {
             using clock = std::chrono::steady_clock;
             auto v = static_cast<std::uint64_t>(clock::now().time_since_epoch().count());
@@ -51,6 +201,23 @@ namespace ltfec::pipeline {
         TxConfig cfg_;
         FecEncoder enc_;
         std::uint32_t next_gen_id_{ 1 };
+
+        // Incremental block state (push_data)
+        std::uint16_t pushed_{ 0 };
+        std::size_t push_len_{ 0 };                 // block width so far
+        std::size_t push_min_len_{ 0 };             // shortest payload so far (varlen once < push_len_)
+        std::size_t push_max_len_{ 0 };             // longest payload so far
+        std::vector<std::uint16_t> push_lens_;      // [N] true payload lengths
+        std::vector<std::uint32_t> push_crcs_;      // [N] data frame CRCs (XOR parity CRC)
+        std::uint32_t push_gen_{ 0 };
+        std::vector<std::vector<std::byte>> acc_;   // [K][push_len_] running parity
+        std::vector<std::byte*> acc_ptrs_;          // [K]
+
+        // Scratch for the slab overload, kept so warm blocks do not allocate
+        std::vector<const std::byte*> slab_data_ptrs_;  // [N]
+        std::vector<std::byte*> slab_parity_ptrs_;      // [K] into the slab
+        std::vector<std::uint16_t> slab_lens_;          // [N] varlen blocks only
+        std::vector<std::uint32_t> slab_crcs_;          // [N] fused XOR only
     };
 
 } // namespace ltfec::pipeline
\ No newline at end of file
@@ -1,4 +1,5 @@
 #pragma once
+#include <cstddef>
 #include <cstdint>
 #include <type_traits>
 
@@ -6,15 +7,45 @@ namespace ltfec::protocol {
 
     // Protocol version for initial wire format.
     inline constexpr std::uint8_t k_protocol_version = 1;
+    // Compact header (see frame_io.h): 8 bytes instead of 16 for blocks it can describe.
+    inline constexpr std::uint8_t k_protocol_version_v2 = 2;
 
     // Flags2 carries parity_count_minus_one (per DESIGN.md).
-    // We reserve the low 8 bits for (K-1). Upper bits reserved.
+    // We reserve the low 8 bits for (K-1). The high 8 bits carry the 2D XOR column count L
+    // (0 for every other scheme).
     inline constexpr std::uint16_t flags2_pack_parity_count_minus_one(std::uint16_t k) noexcept {
         return static_cast<std::uint16_t>((k - 1u) & 0x00FFu);
     }
     inline constexpr std::uint16_t flags2_get_parity_count_minus_one(std::uint16_t flags2) noexcept {
         return static_cast<std::uint16_t>(flags2 & 0x00FFu);
     }
+    inline constexpr std::uint16_t flags2_pack_columns(std::uint16_t flags2, std::uint8_t columns) noexcept {
+        return static_cast<std::uint16_t>((flags2 & 0x00FFu) | (static_cast<std::uint16_t>(columns) << 8));
+    }
+    inline constexpr std::uint8_t flags2_get_columns(std::uint16_t flags2) noexcept {
+        return static_cast<std::uint8_t>(flags2 >> 8);
+    }
+
+    // flags1 bits.
+    // Parity frame of a block whose data payloads differ in length: the payload is the parity over
+    // the data zero-padded to the block width, followed by the N protected lengths (u16 LE each).
+    inline constexpr std::uint8_t k_flags1_varlen = 0x01;
+    inline constexpr std::size_t varlen_table_size(std::size_t data_count) noexcept { return 2 * data_count; }
+    // With k_flags1_varlen: every data payload has the same length, and the table is that one
+    // length instead of N (GF(2^16) blocks of odd-length payloads, padded by a byte).
+    inline constexpr std::uint8_t k_flags1_common_len = 0x08;
+    // Bytes of length table at the end of a parity payload with these flags.
+    inline constexpr std::size_t length_table_size(std::uint8_t flags1, std::size_t data_count) noexcept {
+        if ((flags1 & k_flags1_varlen) == 0) return 0;
+        return varlen_table_size((flags1 & k_flags1_common_len) ? 1u : data_count);
+    }
+
+    // Frame belongs to a sliding-window (rlc_sliding) stream: fec_gen_id is a source sequence
+    // number (data) or the first source covered (repair) instead of a block generation.
+    inline constexpr std::uint8_t k_flags1_sliding_window = 0x02;
+    // Frame belongs to a rateless (lt_fountain) object: seq_in_block is the encoding symbol id,
+    // which keeps growing past data_count for as long as the sender keeps sending.
+    inline constexpr std::uint8_t k_flags1_fountain = 0x04;
 
 #pragma pack(push, 1)
     struct BaseHeader {
@@ -1,6 +1,7 @@
 ﻿#pragma once
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
 #include <span>
 #include <ltfec/protocol/frame.h>
 #include <ltfec/protocol/frame_io.h>
@@ -85,6 +86,85 @@ namespace ltfec::protocol {
         return true;
     }
 
+    // ---- Version 2 (compact header, see frame_io.h) ----
+
+    inline std::size_t encoded_size_v2(std::size_t payload_len, bool with_parity_subheader,
+        bool explicit_len = false) noexcept
+    {
+        return header_v2_size(explicit_len)
+            + (with_parity_subheader ? FrameSizes::kParitySub : 0)
+            + payload_len
+            + FrameSizes::kCrcTrailer;
+    }
+
+    // Same frames as encode_data_frame / encode_parity_frame behind a v2 header. Without
+    // explicit_len the receiver takes payload_len from the datagram size, so exactly
+    // encoded_size_v2() bytes must go out. Returns false also if H does not fit_header_v2.
+    inline bool encode_data_frame_v2(std::span<std::byte> out,
+        const BaseHeader& h,
+        std::span<const std::byte> payload,
+        bool explicit_len = false) noexcept
+    {
+        if (is_parity_frame(h)) return false;
+        if (payload.size() != h.payload_len) return false;
+        if (out.size() < encoded_size_v2(payload.size(), /*with_parity_subheader=*/false, explicit_len)) return false;
+
+        const std::size_t hs = header_v2_size(explicit_len);
+        if (!write_header_v2(out, h, explicit_len)) return false;
+        std::memcpy(out.data() + hs, payload.data(), payload.size());
+        ltfec::util::endian::write_u32_le(out.subspan(hs + payload.size(), 4), ltfec::util::crc32c(payload));
+        return true;
+    }
+
+    inline bool encode_parity_frame_v2(std::span<std::byte> out,
+        const BaseHeader& h,
+        const ParitySubheader& ps,
+        std::span<const std::byte> payload,
+        bool explicit_len = false) noexcept
+    {
+        if (!is_parity_frame(h)) return false;
+        if (payload.size() != h.payload_len) return false;
+        if (out.size() < encoded_size_v2(payload.size(), /*with_parity_subheader=*/true, explicit_len)) return false;
+
+        if (!write_header_v2(out, h, explicit_len)) return false;
+        auto* p = out.data() + header_v2_size(explicit_len);
+        p[0] = std::byte{ ps.fec_scheme_id };
+        p[1] = std::byte{ ps.fec_parity_index };
+        std::memcpy(p + FrameSizes::kParitySub, payload.data(), payload.size());
+        ltfec::util::endian::write_u32_le(std::span<std::byte>(p + FrameSizes::kParitySub + payload.size(), 4),
+            ltfec::util::crc32c(payload));
+        return true;
+    }
+
+    namespace detail {
+        // Everything after the header: optional parity subheader, payload (h.payload_len bytes), CRC.
+        inline bool decode_frame_body(std::span<const std::byte> in, std::size_t off,
+            const BaseHeader& h,
+            bool& has_parity_sub,
+            ParitySubheader& ps_out,
+            std::span<const std::byte>& payload_out,
+            std::uint32_t& crc_out) noexcept
+        {
+            has_parity_sub = is_parity_frame(h);
+
+            const std::size_t header_bytes = off + (has_parity_sub ? FrameSizes::kParitySub : 0);
+            const std::size_t total_needed = header_bytes + h.payload_len + FrameSizes::kCrcTrailer;
+            if (in.size() < total_needed) return false;
+
+            if (has_parity_sub) {
+                ps_out.fec_scheme_id = static_cast<std::uint8_t>(std::to_integer<unsigned char>(in[off + 0]));
+                ps_out.fec_parity_index = static_cast<std::uint8_t>(std::to_integer<unsigned char>(in[off + 1]));
+                off += FrameSizes::kParitySub;
+            }
+
+            payload_out = in.subspan(off, h.payload_len);
+            off += h.payload_len;
+
+            crc_out = ltfec::util::endian::read_u32_le(in.subspan(off, 4));
+            return true;
+        }
+    } // namespace detail
+
     // Parse an encoded frame buffer and expose views.
     // On success, returns true and sets:
     //   h_out          = parsed BaseHeader
@@ -93,6 +173,9 @@ namespace ltfec::protocol {
     //   payload_out    = span view of payload bytes (within 'in')
     //   crc_out        = parsed CRC32C trailer value
     // Performs only size checks; no CRC verification here.
+    // Dispatches on the version byte: v2 frames come back with version = k_protocol_version_v2,
+    // the 16-bit generation zero-extended and (implicit length) payload_len taken from in.size(),
+    // so IN must then be exactly the received datagram.
     inline bool decode_frame(std::span<const std::byte> in,
         BaseHeader& h_out,
         bool& has_parity_sub,
@@ -100,30 +183,25 @@ namespace ltfec::protocol {
         std::span<const std::byte>& payload_out,
         std::uint32_t& crc_out) noexcept
     {
-        // Need at least base header + trailer
-        if (in.size() < FrameSizes::kBase + FrameSizes::kCrcTrailer) return false;
-
-        if (!read_base_header(in.first(FrameSizes::kBase), h_out)) return false;
-
-        has_parity_sub = is_parity_frame(h_out);
-
-        const std::size_t header_bytes = FrameSizes::kBase + (has_parity_sub ? FrameSizes::kParitySub : 0);
-        const std::size_t total_needed = header_bytes + h_out.payload_len + FrameSizes::kCrcTrailer;
-        if (in.size() < total_needed) return false;
-
-        std::size_t off = FrameSizes::kBase;
-
-        if (has_parity_sub) {
-            ps_out.fec_scheme_id = static_cast<std::uint8_t>(std::to_integer<unsigned char>(in[off + 0]));
-            ps_out.fec_parity_index = static_cast<std::uint8_t>(std::to_integer<unsigned char>(in[off + 1]));
-            off += FrameSizes::kParitySub;
+        if (in.empty()) return false;
+
+        if (std::to_integer<unsigned char>(in[0]) == k_protocol_version_v2) {
+            bool explicit_len = false;
+            std::size_t off = 0;
+            if (!read_header_v2(in, h_out, explicit_len, off)) return false;
+            if (!explicit_len) {
+                const std::size_t fixed = off + (is_parity_frame(h_out) ? FrameSizes::kParitySub : 0)
+                    + FrameSizes::kCrcTrailer;
+                if (in.size() < fixed || in.size() - fixed > 0xFFFFu) return false;
+                h_out.payload_len = static_cast<std::uint16_t>(in.size() - fixed);
+            }
+            return detail::decode_frame_body(in, off, h_out, has_parity_sub, ps_out, payload_out, crc_out);
         }
 
-        payload_out = in.subspan(off, h_out.payload_len);
-        off += h_out.payload_len;
-
-        crc_out = ltfec::util::endian::read_u32_le(in.subspan(off, 4));
-        return true;
+        // v1: need at least base header + trailer
+        if (in.size() < FrameSizes::kBase + FrameSizes::kCrcTrailer) return false;
+        if (!read_base_header(in.first(FrameSizes::kBase), h_out)) return false;
+        return detail::decode_frame_body(in, FrameSizes::kBase, h_out, has_parity_sub, ps_out, payload_out, crc_out);
     }
 
     // Verify payload CRC32C against trailer.
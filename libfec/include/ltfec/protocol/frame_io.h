@@ -46,6 +46,80 @@ namespace ltfec::protocol {
         return true;
     }
 
+    // Version 2 (compact) header, little-endian:
+    //   u8  version (= k_protocol_version_v2)
+    //   u8  flags1
+    //   u16 fec_gen_id (low 16 bits of the generation)
+    //   u32 packed: bits 0..10 seq_in_block, 11..20 data_count-1, 21..28 parity_count,
+    //               bit 29 = explicit payload_len follows, bits 30..31 reserved (0)
+    //   [u16 payload_len]  only with bit 29; otherwise derived from the datagram size
+    // flags2 is not sent: K is in the packed word and 2D XOR blocks (columns != 0) stay on v1.
+    struct HeaderV2 {
+        static constexpr std::size_t kSize = 8;
+        static constexpr std::size_t kLenSize = 2;
+        static constexpr std::uint16_t kMaxData = 1024;
+        static constexpr std::uint16_t kMaxParity = 255;
+        static constexpr std::uint32_t kExplicitLen = 1u << 29;
+    };
+
+    inline constexpr std::size_t header_v2_size(bool explicit_len) noexcept {
+        return HeaderV2::kSize + (explicit_len ? HeaderV2::kLenSize : 0);
+    }
+
+    // True if H can be carried by a v2 header (the generation is truncated to 16 bits).
+    // Sliding-window and fountain frames use fec_gen_id/seq_in_block as open-ended counters
+    // and always go out as v1.
+    inline bool fits_header_v2(const BaseHeader& h) noexcept {
+        if (h.flags1 & (k_flags1_sliding_window | k_flags1_fountain)) return false;
+        if (flags2_get_columns(h.flags2) != 0) return false;
+        if (h.data_count == 0 || h.data_count > HeaderV2::kMaxData) return false;
+        if (h.parity_count > HeaderV2::kMaxParity) return false;
+        return h.seq_in_block < h.data_count + h.parity_count;
+    }
+
+    // Serialize H as a v2 header (h.version is ignored). explicit_len: also write payload_len,
+    // for frames that are not sent as a datagram of their own.
+    // Returns false if OUT is too small or H does not fit (fits_header_v2).
+    inline bool write_header_v2(std::span<std::byte> out, const BaseHeader& h, bool explicit_len) noexcept {
+        using namespace ltfec::util::endian;
+        if (out.size() < header_v2_size(explicit_len) || !fits_header_v2(h)) return false;
+        const std::uint32_t packed = static_cast<std::uint32_t>(h.seq_in_block)
+            | (static_cast<std::uint32_t>(h.data_count - 1u) << 11)
+            | (static_cast<std::uint32_t>(h.parity_count) << 21)
+            | (explicit_len ? HeaderV2::kExplicitLen : 0u);
+        out[0] = std::byte{ k_protocol_version_v2 };
+        out[1] = std::byte{ h.flags1 };
+        write_u16_le(out.subspan(2, 2), static_cast<std::uint16_t>(h.fec_gen_id));
+        write_u32_le(out.subspan(4, 4), packed);
+        if (explicit_len) write_u16_le(out.subspan(8, 2), h.payload_len);
+        return true;
+    }
+
+    // Parse a v2 header into the v1 field set. flags2 is rebuilt from K. payload_len is set only
+    // when explicit_len comes back true; header_size receives 8 or 10.
+    inline bool read_header_v2(std::span<const std::byte> in, BaseHeader& h,
+        bool& explicit_len, std::size_t& header_size) noexcept
+    {
+        using namespace ltfec::util::endian;
+        if (in.size() < HeaderV2::kSize) return false;
+        if (std::to_integer<unsigned char>(in[0]) != k_protocol_version_v2) return false;
+        const std::uint32_t packed = read_u32_le(in.subspan(4, 4));
+        if (packed >> 30) return false; // reserved bits
+        explicit_len = (packed & HeaderV2::kExplicitLen) != 0;
+        header_size = header_v2_size(explicit_len);
+        if (in.size() < header_size) return false;
+
+        h.version = k_protocol_version_v2;
+        h.flags1 = static_cast<std::uint8_t>(std::to_integer<unsigned char>(in[1]));
+        h.fec_gen_id = read_u16_le(in.subspan(2, 2));
+        h.seq_in_block = static_cast<std::uint16_t>(packed & 0x7FFu);
+        h.data_count = static_cast<std::uint16_t>(((packed >> 11) & 0x3FFu) + 1u);
+        h.parity_count = static_cast<std::uint16_t>((packed >> 21) & 0xFFu);
+        h.flags2 = flags2_pack_parity_count_minus_one(h.parity_count);
+        h.payload_len = explicit_len ? read_u16_le(in.subspan(8, 2)) : std::uint16_t{ 0 };
+        return true;
+    }
+
     // CRC32C of payload only (for on-wire validation).
     inline std::uint32_t crc32c_payload(std::span<const std::byte> payload) noexcept {
         return ltfec::util::crc32c(payload);
@@ -4,11 +4,21 @@
 namespace ltfec::protocol {
 
     // Forward set of FEC scheme identifiers.
-    // 1 = baseline XOR (K=1), 10..13 reserved for GF(256) with K=2..4 (subject to DESIGN.md).
+    // 1 = baseline XOR (K=1), 10..13 reserved for GF(256) with K=2..4 (subject to DESIGN.md),
+    // 20 = systematic Cauchy RS over GF(256) with K=1..32 (N+K <= 256),
+    // 21 = systematic Cauchy RS over GF(2^16) with K=1..256 (N+K <= 65536, even payload lengths),
+    // 30 = sliding-window random linear code over GF(256) (RFC 8681 style, no blocks),
+    // 40 = 2D row/column XOR over an L×D matrix (L carried in flags2 high byte),
+    // 50 = rateless LT fountain code (systematic, peeling decoder, no fixed K).
     enum class fec_scheme_id : std::uint8_t {
         xor_k1 = 1,
         gf256_k2 = 10,
         gf256_k3 = 11,
         gf256_k4 = 12,
+        cauchy_gf256 = 20,
+        cauchy_gf65536 = 21,
+        rlc_sliding = 30,
+        xor_2d = 40,
+        lt_fountain = 50,
     };
 } // namespace ltfec::protocol
\ No newline at end of file
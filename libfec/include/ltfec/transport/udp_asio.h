@@ -30,6 +30,14 @@ namespace ltfec::transport::asio {
 
         std::error_code send(std::span<const std::byte> buf, std::size_t& sent);
 
+        // One datagram gathered from three buffers (sendmsg iovecs / WSASendTo buffer array), so a
+        // frame can go out as header ++ payload ++ trailer without first copying the payload
+        // behind its header. Any part may be empty.
+        std::error_code send_gather(std::span<const std::byte> head,
+            std::span<const std::byte> payload,
+            std::span<const std::byte> trailer,
+            std::size_t& sent);
+
     private:
         udp::socket   socket_;
         udp::endpoint dest_ep_;
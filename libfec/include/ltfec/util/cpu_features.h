@@ -0,0 +1,48 @@
+#pragma once
+#include <cstdint>
+
+// Target/arch helpers shared by the SIMD kernels.
+// MSVC exposes every intrinsic unconditionally; GCC/Clang need a per-function target attribute
+// so the library itself can still be compiled for the baseline ISA.
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#define LTFEC_X86 1
+#else
+#define LTFEC_X86 0
+#endif
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#define LTFEC_TARGET(isa)
+#else
+#define LTFEC_TARGET(isa) __attribute__((target(isa)))
+#endif
+
+namespace ltfec::util {
+
+    // Instruction-set tiers used for runtime kernel dispatch (ordered: higher implies lower).
+    enum class SimdLevel : std::uint8_t {
+        scalar = 0, // portable C++
+        ssse3 = 1,  // 128-bit (SSE2 + PSHUFB)
+        avx2 = 2,   // 256-bit
+    };
+
+    struct CpuFeatures {
+        bool sse2{ false };
+        bool ssse3{ false };
+        bool sse42{ false };  // CRC32 instruction
+        bool pclmul{ false };
+        bool avx2{ false };   // includes OS support for YMM state
+    };
+
+    // Detected once (thread-safe) on first use.
+    const CpuFeatures& cpu_features() noexcept;
+
+    // Highest SimdLevel supported by this CPU.
+    SimdLevel best_simd_level() noexcept;
+
+    // Clamp a requested level to what the CPU actually supports.
+    inline SimdLevel clamp_simd_level(SimdLevel want) noexcept {
+        const SimdLevel best = best_simd_level();
+        return (static_cast<std::uint8_t>(want) <= static_cast<std::uint8_t>(best)) ? want : best;
+    }
+
+} // namespace ltfec::util
@@ -18,4 +18,25 @@ namespace ltfec::util {
 	uint32_t crc32c_update(uint32_t state, std::span<const std::byte> data) noexcept;
 	inline constexpr uint32_t crc32c_finish(uint32_t state) noexcept { return state ^ 0xFFFF'FFFFu; }
 
+	// crc32c_update picks its kernel once at runtime: the SSE4.2 crc32 instruction (x64), run as
+	// three interleaved streams that are stitched back together, or portable slicing-by-8.
+	// Same as crc32c_update but always on the portable path (tests and benchmarks).
+	uint32_t crc32c_update_portable(uint32_t state, std::span<const std::byte> data) noexcept;
+	// True when crc32c_update runs on the hardware path.
+	bool crc32c_hardware() noexcept;
+
+	// CRC algebra on finished CRC values (no pass over the data). All run in O(log len).
+	// Multiply a CRC by x^(8*len): the contribution of a prefix once len more bytes follow it.
+	// crc32c_combine(a, b, n) == crc32c_shift(a, n) ^ b.
+	uint32_t crc32c_shift(uint32_t crc, std::size_t len) noexcept;
+	// crc32c(A || B) from crc32c(A), crc32c(B) and |B|.
+	inline uint32_t crc32c_combine(uint32_t crc_a, uint32_t crc_b, std::size_t len_b) noexcept {
+		return crc32c_shift(crc_a, len_b) ^ crc_b;
+	}
+	// crc32c of len zero bytes.
+	uint32_t crc32c_zeros(std::size_t len) noexcept;
+	// crc32c(B_0 ^ B_1 ^ ... ^ B_{m-1}) for m buffers of len bytes each, from their CRCs.
+	// CRC32C is affine in the data: XOR of the CRCs is off by crc32c_zeros(len) when m is even.
+	uint32_t crc32c_xor_of(std::span<const uint32_t> crcs, std::size_t len) noexcept;
+
 } // namespace ltfec::util
\ No newline at end of file
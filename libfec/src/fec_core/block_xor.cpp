@@ -1,5 +1,6 @@
 #include <ltfec/fec_core/block_xor.h>
 #include <ltfec/fec_core/xor_parity.h>
+#include <ltfec/fec_core/xor_region.h>
 #include <algorithm>
 
 namespace ltfec::fec_core {
@@ -30,15 +31,8 @@ namespace ltfec::fec_core {
         }
         if (missing == -1) return -1; // none missing
 
-        // Start with parity, then XOR all present frames.
-        std::copy_n(parity.begin(), frame_len, out_recovered.begin());
-        for (std::size_t i = 0; i < data_frames.size(); ++i) {
-            const std::byte* f = data_frames[i];
-            if (!f) continue;
-            for (std::size_t j = 0; j < frame_len; ++j) {
-                out_recovered[j] ^= f[j];
-            }
-        }
+        // Seed with parity, then fold in all present frames (the missing one is nullptr).
+        xor_regions(out_recovered.data(), parity.data(), data_frames, frame_len);
         return missing;
     }
 
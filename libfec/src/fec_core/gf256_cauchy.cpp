@@ -0,0 +1,29 @@
+#include <ltfec/fec_core/gf256_cauchy.h>
+#include <ltfec/fec_core/gf256.h>
+
+namespace ltfec::fec_core {
+
+    namespace {
+        std::uint8_t cauchy_coef_fn(std::size_t j, std::size_t d) noexcept { return cauchy_coef(j, d); }
+    }
+
+    void gf256_cauchy_encode(std::span<const std::byte* const> data_frames,
+        std::size_t frame_len,
+        std::span<std::byte*> parity_frames) noexcept
+    {
+        if (!cauchy_supports(data_frames.size(), parity_frames.size())) return;
+        gf256_encode_rows(&cauchy_coef_fn, data_frames, frame_len, parity_frames);
+    }
+
+    bool gf256_cauchy_recover(std::span<const std::byte* const> data_ptrs,
+        std::span<const std::byte* const> parity_ptrs,
+        std::size_t frame_len,
+        std::span<const std::uint16_t> missing_indices,
+        std::span<std::byte*> out_recovered) noexcept
+    {
+        if (!cauchy_supports(data_ptrs.size(), parity_ptrs.size())) return false;
+        return gf256_recover_erasures(&cauchy_coef_fn, data_ptrs, parity_ptrs, frame_len,
+            missing_indices, out_recovered);
+    }
+
+} // namespace ltfec::fec_core
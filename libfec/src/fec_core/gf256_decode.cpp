@@ -1,4 +1,7 @@
 ﻿#include <ltfec/fec_core/gf256_decode.h>
+#include <ltfec/fec_core/gf256_field.h>
+#include <ltfec/fec_core/gf256_region.h>
+#include <ltfec/fec_core/gf256.h>
 #include <array>
 #include <vector>
 #include <cstdint>
@@ -7,137 +10,144 @@
 
 namespace ltfec::fec_core {
 
-    namespace {
-        // GF(256) with primitive polynomial 0x11D, generator α=2.
-        static constexpr std::uint16_t kPoly = 0x11D;
-
-        struct Tables {
-            std::array<std::uint8_t, 512> exp{};
-            std::array<std::uint8_t, 256> log{};
-            bool inited{ false };
-        };
-
-        static Tables& T() {
-            static Tables t;
-            if (!t.inited) {
-                std::uint16_t x = 1;
-                for (int i = 0; i < 255; ++i) {
-                    t.exp[i] = static_cast<std::uint8_t>(x);
-                    t.log[t.exp[i]] = static_cast<std::uint8_t>(i);
-                    x <<= 1;
-                    if (x & 0x100) x ^= kPoly;
-                }
-                for (int i = 255; i < 512; ++i) t.exp[i] = t.exp[i - 255];
-                t.inited = true;
-            }
-            return t;
-        }
-        static inline std::uint8_t gf_add(std::uint8_t a, std::uint8_t b) { return a ^ b; }
-        static inline std::uint8_t gf_mul(std::uint8_t a, std::uint8_t b) {
-            if (!a || !b) return 0;
-            auto& tb = T();
-            return tb.exp[tb.log[a] + tb.log[b]];
-        }
-        static inline std::uint8_t gf_inv(std::uint8_t a) {
-            auto& tb = T();
-            // a^{-1} = α^{255 - log(a)}
-            return tb.exp[255 - tb.log[a]];
-        }
-        static inline std::uint8_t gf_pow_alpha(unsigned e) {
-            auto& tb = T();
-            return tb.exp[e % 255];
-        }
-    } // namespace
+    using gf256::add;
+    using gf256::mul;
+    using gf256::inv;
 
-    // Solve A x = b over GF(256), A is m×m, b is m×1; in-place Gauss-Jordan.
-    // Returns false if singular (shouldn't happen with proper Vandermonde rows).
-    static bool solve_gf256(std::vector<std::uint8_t>& A, std::vector<std::uint8_t>& b, int m) {
+    bool gf256_invert_matrix(std::span<std::uint8_t> a, int m) noexcept {
+        if (m <= 0 || a.size() < static_cast<std::size_t>(m) * static_cast<std::size_t>(m)) return false;
+        if (m > kMaxInvertDim) return false;
         auto idx = [&](int r, int c) { return r * m + c; };
 
-        for (int col = 0, row = 0; col < m && row < m; ++col, ++row) {
+        // Gauss-Jordan on [A | I]; the right half ends up holding A^-1.
+        std::array<std::uint8_t, kMaxInvertDim * kMaxInvertDim> res{};
+        for (int i = 0; i < m; ++i) res[idx(i, i)] = 1;
+
+        for (int col = 0; col < m; ++col) {
             // Find pivot
-            int piv = row;
-            while (piv < m && A[idx(piv, col)] == 0) ++piv;
+            int piv = col;
+            while (piv < m && a[idx(piv, col)] == 0) ++piv;
             if (piv == m) return false; // singular
-            if (piv != row) {
-                for (int c = col; c < m; ++c) std::swap(A[idx(row, c)], A[idx(piv, c)]);
-                std::swap(b[row], b[piv]);
+            if (piv != col) {
+                for (int c = 0; c < m; ++c) {
+                    std::swap(a[idx(col, c)], a[idx(piv, c)]);
+                    std::swap(res[idx(col, c)], res[idx(piv, c)]);
+                }
             }
 
             // Scale pivot row
-            std::uint8_t inv = gf_inv(A[idx(row, col)]);
-            for (int c = col; c < m; ++c) A[idx(row, c)] = gf_mul(A[idx(row, c)], inv);
-            b[row] = gf_mul(b[row], inv);
+            const std::uint8_t s = inv(a[idx(col, col)]);
+            for (int c = 0; c < m; ++c) {
+                a[idx(col, c)] = mul(a[idx(col, c)], s);
+                res[idx(col, c)] = mul(res[idx(col, c)], s);
+            }
 
             // Eliminate other rows
-            for (int r = 0; r < m; ++r) if (r != row) {
-                std::uint8_t f = A[idx(r, col)];
+            for (int r = 0; r < m; ++r) if (r != col) {
+                const std::uint8_t f = a[idx(r, col)];
                 if (!f) continue;
-                for (int c = col; c < m; ++c)
-                    A[idx(r, c)] = gf_add(A[idx(r, c)], gf_mul(f, A[idx(row, c)]));
-                b[r] = gf_add(b[r], gf_mul(f, b[row]));
+                for (int c = 0; c < m; ++c) {
+                    a[idx(r, c)] = add(a[idx(r, c)], mul(f, a[idx(col, c)]));
+                    res[idx(r, c)] = add(res[idx(r, c)], mul(f, res[idx(col, c)]));
+                }
             }
         }
+
+        std::copy_n(res.begin(), static_cast<std::size_t>(m) * m, a.begin());
         return true;
     }
 
-    bool gf256_recover_erasures_vandermonde(std::span<const std::byte* const> data_ptrs,
-        std::span<const std::byte* const> parity_ptrs,
+    bool gf256_recover_from_syndromes(Gf256CoefFn coef,
+        std::span<const std::byte* const> syndromes,
         std::size_t frame_len,
         std::span<const std::uint16_t> missing_indices,
         std::span<std::byte*> out_recovered) noexcept
     {
         const int m = static_cast<int>(missing_indices.size());
         if (m == 0) return true;
-        if (m > 4) return false;
+        if (m > kMaxInvertDim) return false;
         if (out_recovered.size() != static_cast<size_t>(m)) return false;
 
-        // Collect the first m available parity rows (j values)
-        std::vector<int> rows;
-        rows.reserve(m);
-        for (int j = 0; j < static_cast<int>(parity_ptrs.size()); ++j) {
-            if (parity_ptrs[j] != nullptr) rows.push_back(j);
-            if (static_cast<int>(rows.size()) == m) break;
+        // Collect the first m available rows (j values)
+        std::array<int, kMaxInvertDim> rows{};
+        int have = 0;
+        for (int j = 0; j < static_cast<int>(syndromes.size()) && have < m; ++j) {
+            if (syndromes[j] != nullptr) rows[have++] = j;
         }
-        if (static_cast<int>(rows.size()) < m) return false; // insufficient equations
-
-        // Precompute known-data contributions per row (for RHS)
-        const std::size_t N = data_ptrs.size();
-
-        // For each byte position, build A (m×m) and b (m) then solve.
-        for (std::size_t i = 0; i < frame_len; ++i) {
-            std::vector<std::uint8_t> A(m * m, 0u);
-            std::vector<std::uint8_t> b(m, 0u);
-
-            for (int r = 0; r < m; ++r) {
-                const int j = rows[r];
-                // Start with parity byte
-                std::uint8_t rhs = static_cast<std::uint8_t>(parity_ptrs[j][i]);
-
-                // Subtract known-data contributions: rhs -= Σ_known α^(j*d) * data[d][i]
-                for (std::size_t d = 0; d < N; ++d) {
-                    if (data_ptrs[d] == nullptr) continue; // missing -> unknown variable
-                    const std::uint8_t coef = gf_pow_alpha(static_cast<unsigned>(j * static_cast<int>(d)));
-                    rhs = gf_add(rhs, gf_mul(coef, static_cast<std::uint8_t>(data_ptrs[d][i])));
-                }
-                b[r] = rhs;
+        if (have < m) return false; // insufficient equations
 
-                // Fill matrix columns for unknowns (missing indices)
-                for (int c = 0; c < m; ++c) {
-                    const int d = static_cast<int>(missing_indices[c]);
-                    A[r * m + c] = gf_pow_alpha(static_cast<unsigned>(j * d));
-                }
+        // Coefficient matrix for the unknowns, built and inverted once per block:
+        // A[r][c] = coef(j_r, d_c)
+        std::array<std::uint8_t, kMaxInvertDim * kMaxInvertDim> A{};
+        for (int r = 0; r < m; ++r) {
+            for (int c = 0; c < m; ++c) {
+                A[r * m + c] = coef(static_cast<std::size_t>(rows[r]), missing_indices[c]);
+            }
+        }
+        if (!gf256_invert_matrix(std::span<std::uint8_t>(A.data(), static_cast<std::size_t>(m) * m), m)) return false;
+        if (frame_len == 0) return true;
+
+        // x = A^-1 * s, as region linear combinations of the selected syndromes.
+        for (int c = 0; c < m; ++c) {
+            std::byte* out = out_recovered[c];
+            gf256_mul_region(out, syndromes[rows[0]], A[c * m + 0], frame_len);
+            for (int r = 1; r < m; ++r) {
+                gf256_mul_add_region(out, syndromes[rows[r]], A[c * m + r], frame_len);
             }
+        }
 
-            if (!solve_gf256(A, b, m)) return false;
+        return true;
+    }
 
-            // b now holds the solution vector x; write to outputs
-            for (int c = 0; c < m; ++c) {
-                out_recovered[c][i] = static_cast<std::byte>(b[c]);
+    bool gf256_recover_erasures(Gf256CoefFn coef,
+        std::span<const std::byte* const> data_ptrs,
+        std::span<const std::byte* const> parity_ptrs,
+        std::size_t frame_len,
+        std::span<const std::uint16_t> missing_indices,
+        std::span<std::byte*> out_recovered) noexcept
+    {
+        const std::size_t m = missing_indices.size();
+        if (m == 0) return true;
+        if (m > static_cast<std::size_t>(kMaxInvertDim)) return false;
+
+        // Only the first m available parity rows take part in the solve; reduce just those.
+        std::array<const std::byte*, kMaxInvertDim> syn{};
+        const std::size_t K = std::min(parity_ptrs.size(), syn.size());
+        std::size_t have = 0;
+        for (std::size_t j = 0; j < K && have < m; ++j) {
+            if (parity_ptrs[j] != nullptr) { syn[j] = parity_ptrs[j]; ++have; }
+        }
+        if (have < m) return false; // insufficient equations
+
+        // Syndrome per selected row, whole-region: s_j = parity[j] ^ Σ_known coef(j, d) * data[d]
+        std::vector<std::byte> rhs(m * frame_len);
+        std::size_t r = 0;
+        for (std::size_t j = 0; j < K && r < m; ++j) {
+            if (syn[j] == nullptr) continue;
+            std::byte* dst = rhs.data() + r * frame_len;
+            if (frame_len) std::memcpy(dst, syn[j], frame_len);
+            for (std::size_t d = 0; d < data_ptrs.size(); ++d) {
+                if (data_ptrs[d] == nullptr) continue; // missing -> unknown variable
+                gf256_mul_add_region(dst, data_ptrs[d], coef(j, d), frame_len);
             }
+            syn[j] = dst;
+            ++r;
         }
 
-        return true;
+        return gf256_recover_from_syndromes(coef,
+            std::span<const std::byte* const>(syn.data(), K),
+            frame_len, missing_indices, out_recovered);
+    }
+
+    bool gf256_recover_erasures_vandermonde(std::span<const std::byte* const> data_ptrs,
+        std::span<const std::byte* const> parity_ptrs,
+        std::size_t frame_len,
+        std::span<const std::uint16_t> missing_indices,
+        std::span<std::byte*> out_recovered) noexcept
+    {
+        if (missing_indices.size() > 4) return false;
+        return gf256_recover_erasures(&vandermonde_coef, data_ptrs, parity_ptrs, frame_len,
+            missing_indices, out_recovered);
     }
 
-} // namespace ltfec::fec_core
\ No newline at end of file
+} // namespace ltfec::fec_core
@@ -0,0 +1,121 @@
+#include <ltfec/fec_core/gf256_region.h>
+#include <ltfec/fec_core/gf256_field.h>
+#include <cstring>
+
+#if LTFEC_X86
+#include <immintrin.h>
+#endif
+
+namespace ltfec::fec_core {
+
+    using ltfec::util::SimdLevel;
+
+    namespace {
+
+        void xor_region(std::byte* dst, const std::byte* src, std::size_t len) noexcept {
+            std::size_t i = 0;
+            for (; i + 8 <= len; i += 8) {
+                std::uint64_t a, b;
+                std::memcpy(&a, dst + i, 8);
+                std::memcpy(&b, src + i, 8);
+                a ^= b;
+                std::memcpy(dst + i, &a, 8);
+            }
+            for (; i < len; ++i) dst[i] ^= src[i];
+        }
+
+        // ---- scalar: one product-table row lookup per byte ----
+        void mul_add_scalar(std::byte* dst, const std::byte* src, const std::uint8_t* row, std::size_t len) noexcept {
+            for (std::size_t i = 0; i < len; ++i) {
+                dst[i] ^= std::byte{ row[std::to_integer<std::uint8_t>(src[i])] };
+            }
+        }
+
+#if LTFEC_X86
+        // ---- SSSE3: 16 bytes per step ----
+        LTFEC_TARGET("ssse3")
+        std::size_t mul_add_ssse3(std::byte* dst, const std::byte* src, const std::uint8_t* tbl, std::size_t len) noexcept {
+            const __m128i lo = _mm_load_si128(reinterpret_cast<const __m128i*>(tbl));
+            const __m128i hi = _mm_load_si128(reinterpret_cast<const __m128i*>(tbl + 16));
+            const __m128i mask = _mm_set1_epi8(0x0F);
+            std::size_t i = 0;
+            for (; i + 16 <= len; i += 16) {
+                const __m128i s = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+                const __m128i l = _mm_and_si128(s, mask);
+                const __m128i h = _mm_and_si128(_mm_srli_epi64(s, 4), mask);
+                const __m128i p = _mm_xor_si128(_mm_shuffle_epi8(lo, l), _mm_shuffle_epi8(hi, h));
+                const __m128i d = _mm_loadu_si128(reinterpret_cast<const __m128i*>(dst + i));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm_xor_si128(d, p));
+            }
+            return i;
+        }
+
+        // ---- AVX2: 32 bytes per step ----
+        LTFEC_TARGET("avx2")
+        std::size_t mul_add_avx2(std::byte* dst, const std::byte* src, const std::uint8_t* tbl, std::size_t len) noexcept {
+            const __m256i lo = _mm256_broadcastsi128_si256(_mm_load_si128(reinterpret_cast<const __m128i*>(tbl)));
+            const __m256i hi = _mm256_broadcastsi128_si256(_mm_load_si128(reinterpret_cast<const __m128i*>(tbl + 16)));
+            const __m256i mask = _mm256_set1_epi8(0x0F);
+            std::size_t i = 0;
+            for (; i + 32 <= len; i += 32) {
+                const __m256i s = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+                const __m256i l = _mm256_and_si256(s, mask);
+                const __m256i h = _mm256_and_si256(_mm256_srli_epi64(s, 4), mask);
+                const __m256i p = _mm256_xor_si256(_mm256_shuffle_epi8(lo, l), _mm256_shuffle_epi8(hi, h));
+                const __m256i d = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(dst + i));
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), _mm256_xor_si256(d, p));
+            }
+            return i;
+        }
+#endif
+
+        void mul_add_dispatch(std::byte* dst, const std::byte* src, std::uint8_t c, std::size_t len,
+            SimdLevel level) noexcept
+        {
+            if (c == 0 || len == 0) return;
+            if (c == 1) { xor_region(dst, src, len); return; }
+
+            std::size_t done = 0;
+#if LTFEC_X86
+            const std::uint8_t* tbl = gf256::kNibble[c].data();
+            if (level == SimdLevel::avx2) done = mul_add_avx2(dst, src, tbl, len);
+            if (level >= SimdLevel::ssse3) done += mul_add_ssse3(dst + done, src + done, tbl, len - done);
+#else
+            (void)level;
+#endif
+            mul_add_scalar(dst + done, src + done, gf256::kMul[c].data(), len - done);
+        }
+
+    } // namespace
+
+    void gf256_mul_add_region(std::byte* dst, const std::byte* src, std::uint8_t c, std::size_t len) noexcept {
+        static const SimdLevel level = ltfec::util::best_simd_level();
+        mul_add_dispatch(dst, src, c, len, level);
+    }
+
+    void gf256_mul_add_region(std::byte* dst, const std::byte* src, std::uint8_t c, std::size_t len,
+        SimdLevel level) noexcept
+    {
+        mul_add_dispatch(dst, src, c, len, ltfec::util::clamp_simd_level(level));
+    }
+
+    void gf256_mul_region(std::byte* dst, const std::byte* src, std::uint8_t c, std::size_t len) noexcept {
+        if (len == 0) return;
+        if (c == 0) { std::memset(dst, 0, len); return; }
+        if (c == 1) { if (dst != src) std::memmove(dst, src, len); return; }
+        if (dst == src) {
+            // In-place: scale through a small stack buffer so the kernel can accumulate into zeros.
+            alignas(32) std::byte tmp[256];
+            for (std::size_t off = 0; off < len; off += sizeof(tmp)) {
+                const std::size_t n = (len - off < sizeof(tmp)) ? (len - off) : sizeof(tmp);
+                std::memset(tmp, 0, n);
+                gf256_mul_add_region(tmp, src + off, c, n);
+                std::memcpy(dst + off, tmp, n);
+            }
+            return;
+        }
+        std::memset(dst, 0, len);
+        gf256_mul_add_region(dst, src, c, len);
+    }
+
+} // namespace ltfec::fec_core
@@ -0,0 +1,202 @@
+#include <ltfec/fec_core/gf65536.h>
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+namespace ltfec::fec_core {
+
+    namespace gf65536 {
+
+        namespace {
+            struct ExpLog {
+                std::vector<std::uint16_t> exp; // α^i, duplicated past 65535 so exp[log a + log b] needs no modulo
+                std::vector<std::uint16_t> log; // log[0] unused
+
+                ExpLog() : exp(2 * 65535), log(65536, 0) {
+                    std::uint32_t x = 1;
+                    for (std::uint32_t i = 0; i < 65535; ++i) {
+                        exp[i] = static_cast<std::uint16_t>(x);
+                        log[x] = static_cast<std::uint16_t>(i);
+                        x <<= 1;
+                        if (x & 0x10000u) x ^= kPoly;
+                    }
+                    for (std::uint32_t i = 65535; i < 2 * 65535; ++i) exp[i] = exp[i - 65535];
+                }
+            };
+
+            // 384 KiB: too large for a constexpr table, so built once on first use.
+            const ExpLog& tables() noexcept {
+                static const ExpLog t;
+                return t;
+            }
+        } // namespace
+
+        std::uint16_t mul(std::uint16_t a, std::uint16_t b) noexcept {
+            if (a == 0 || b == 0) return 0;
+            const ExpLog& t = tables();
+            return t.exp[static_cast<std::size_t>(t.log[a]) + t.log[b]];
+        }
+
+        std::uint16_t inv(std::uint16_t a) noexcept {
+            if (a == 0) return 0;
+            const ExpLog& t = tables();
+            return t.exp[65535u - t.log[a]];
+        }
+
+        std::uint16_t pow_alpha(std::uint32_t e) noexcept {
+            return tables().exp[e % 65535u];
+        }
+
+    } // namespace gf65536
+
+    using gf65536::mul;
+    using gf65536::inv;
+
+    bool gf65536_invert_matrix(std::span<std::uint16_t> a, int m) noexcept {
+        if (m <= 0 || a.size() < static_cast<std::size_t>(m) * static_cast<std::size_t>(m)) return false;
+        if (m > static_cast<int>(kGf65536MaxParity)) return false;
+        auto idx = [&](int r, int c) { return static_cast<std::size_t>(r) * m + c; };
+
+        // Gauss-Jordan on [A | I]; the right half ends up holding A^-1.
+        std::vector<std::uint16_t> res(static_cast<std::size_t>(m) * m, 0);
+        for (int i = 0; i < m; ++i) res[idx(i, i)] = 1;
+
+        for (int col = 0; col < m; ++col) {
+            int piv = col;
+            while (piv < m && a[idx(piv, col)] == 0) ++piv;
+            if (piv == m) return false; // singular
+            if (piv != col) {
+                for (int c = 0; c < m; ++c) {
+                    std::swap(a[idx(col, c)], a[idx(piv, c)]);
+                    std::swap(res[idx(col, c)], res[idx(piv, c)]);
+                }
+            }
+
+            const std::uint16_t s = inv(a[idx(col, col)]);
+            for (int c = 0; c < m; ++c) {
+                a[idx(col, c)] = mul(a[idx(col, c)], s);
+                res[idx(col, c)] = mul(res[idx(col, c)], s);
+            }
+
+            for (int r = 0; r < m; ++r) if (r != col) {
+                const std::uint16_t f = a[idx(r, col)];
+                if (!f) continue;
+                for (int c = 0; c < m; ++c) {
+                    a[idx(r, c)] ^= mul(f, a[idx(col, c)]);
+                    res[idx(r, c)] ^= mul(f, res[idx(col, c)]);
+                }
+            }
+        }
+
+        std::copy(res.begin(), res.end(), a.begin());
+        return true;
+    }
+
+    void gf65536_encode_rows(Gf65536CoefFn coef,
+        std::span<const std::byte* const> data_frames,
+        std::size_t frame_len,
+        std::span<std::byte*> parity_frames) noexcept
+    {
+        for (std::size_t j = 0; j < parity_frames.size(); ++j) {
+            std::byte* p = parity_frames[j];
+            if (!p) continue;
+            std::memset(p, 0, frame_len);
+            for (std::size_t d = 0; d < data_frames.size(); ++d) {
+                gf65536_mul_add_region(p, data_frames[d], coef(j, d), frame_len);
+            }
+        }
+    }
+
+    bool gf65536_recover_from_syndromes(Gf65536CoefFn coef,
+        std::span<const std::byte* const> syndromes,
+        std::size_t frame_len,
+        std::span<const std::uint16_t> missing_indices,
+        std::span<std::byte*> out_recovered) noexcept
+    {
+        const int m = static_cast<int>(missing_indices.size());
+        if (m == 0) return true;
+        if (m > static_cast<int>(kGf65536MaxParity)) return false;
+        if (out_recovered.size() != static_cast<std::size_t>(m)) return false;
+
+        // First m available rows
+        std::vector<int> rows;
+        rows.reserve(m);
+        for (int j = 0; j < static_cast<int>(syndromes.size()) && static_cast<int>(rows.size()) < m; ++j) {
+            if (syndromes[j] != nullptr) rows.push_back(j);
+        }
+        if (static_cast<int>(rows.size()) < m) return false; // insufficient equations
+
+        // A[r][c] = coef(j_r, d_c), inverted once per block
+        std::vector<std::uint16_t> A(static_cast<std::size_t>(m) * m);
+        for (int r = 0; r < m; ++r) {
+            for (int c = 0; c < m; ++c) {
+                A[static_cast<std::size_t>(r) * m + c] = coef(static_cast<std::size_t>(rows[r]), missing_indices[c]);
+            }
+        }
+        if (!gf65536_invert_matrix(std::span<std::uint16_t>(A), m)) return false;
+        if (frame_len == 0) return true;
+
+        // x = A^-1 * s
+        for (int c = 0; c < m; ++c) {
+            std::byte* out = out_recovered[c];
+            gf65536_mul_region(out, syndromes[rows[0]], A[static_cast<std::size_t>(c) * m], frame_len);
+            for (int r = 1; r < m; ++r) {
+                gf65536_mul_add_region(out, syndromes[rows[r]], A[static_cast<std::size_t>(c) * m + r], frame_len);
+            }
+        }
+        return true;
+    }
+
+    bool gf65536_recover_erasures(Gf65536CoefFn coef,
+        std::span<const std::byte* const> data_ptrs,
+        std::span<const std::byte* const> parity_ptrs,
+        std::size_t frame_len,
+        std::span<const std::uint16_t> missing_indices,
+        std::span<std::byte*> out_recovered) noexcept
+    {
+        const std::size_t m = missing_indices.size();
+        if (m == 0) return true;
+        if (m > kGf65536MaxParity) return false;
+
+        // Reduce only the first m available parity rows: s_j = parity[j] ^ Σ_known coef(j, d) * data[d]
+        const std::size_t K = std::min(parity_ptrs.size(), kGf65536MaxParity);
+        std::vector<const std::byte*> syn(K, nullptr);
+        std::vector<std::byte> rhs(m * frame_len);
+        std::size_t r = 0;
+        for (std::size_t j = 0; j < K && r < m; ++j) {
+            if (parity_ptrs[j] == nullptr) continue;
+            std::byte* dst = rhs.data() + r * frame_len;
+            if (frame_len) std::memcpy(dst, parity_ptrs[j], frame_len);
+            for (std::size_t d = 0; d < data_ptrs.size(); ++d) {
+                if (data_ptrs[d] == nullptr) continue;
+                gf65536_mul_add_region(dst, data_ptrs[d], coef(j, d), frame_len);
+            }
+            syn[j] = dst;
+            ++r;
+        }
+        if (r < m) return false; // insufficient equations
+
+        return gf65536_recover_from_syndromes(coef, std::span<const std::byte* const>(syn),
+            frame_len, missing_indices, out_recovered);
+    }
+
+    void gf65536_cauchy_encode(std::span<const std::byte* const> data_frames,
+        std::size_t frame_len,
+        std::span<std::byte*> parity_frames) noexcept
+    {
+        if (!gf65536_cauchy_supports(data_frames.size(), parity_frames.size()) || (frame_len & 1u)) return;
+        gf65536_encode_rows(&gf65536_cauchy_coef, data_frames, frame_len, parity_frames);
+    }
+
+    bool gf65536_cauchy_recover(std::span<const std::byte* const> data_ptrs,
+        std::span<const std::byte* const> parity_ptrs,
+        std::size_t frame_len,
+        std::span<const std::uint16_t> missing_indices,
+        std::span<std::byte*> out_recovered) noexcept
+    {
+        if (!gf65536_cauchy_supports(data_ptrs.size(), parity_ptrs.size()) || (frame_len & 1u)) return false;
+        return gf65536_recover_erasures(&gf65536_cauchy_coef, data_ptrs, parity_ptrs, frame_len,
+            missing_indices, out_recovered);
+    }
+
+} // namespace ltfec::fec_core
@@ -0,0 +1,181 @@
+#include <ltfec/fec_core/gf65536.h>
+#include <cstring>
+
+#if LTFEC_X86
+#include <immintrin.h>
+#endif
+
+namespace ltfec::fec_core {
+
+    using ltfec::util::SimdLevel;
+
+    namespace {
+
+        // Split tables for coefficient c: for nibble position k (bits 4k..4k+3 of the symbol),
+        // lo[k][v] / hi[k][v] are the low / high bytes of c * (v << 4k).
+        struct SplitTables {
+            alignas(16) std::uint8_t lo[4][16];
+            alignas(16) std::uint8_t hi[4][16];
+        };
+
+        void make_split(std::uint16_t c, SplitTables& t) noexcept {
+            for (int k = 0; k < 4; ++k) {
+                for (int v = 0; v < 16; ++v) {
+                    const std::uint16_t p = gf65536::mul(c, static_cast<std::uint16_t>(v << (4 * k)));
+                    t.lo[k][v] = static_cast<std::uint8_t>(p & 0xFFu);
+                    t.hi[k][v] = static_cast<std::uint8_t>(p >> 8);
+                }
+            }
+        }
+
+        void xor_region(std::byte* dst, const std::byte* src, std::size_t len) noexcept {
+            std::size_t i = 0;
+            for (; i + 8 <= len; i += 8) {
+                std::uint64_t a, b;
+                std::memcpy(&a, dst + i, 8);
+                std::memcpy(&b, src + i, 8);
+                a ^= b;
+                std::memcpy(dst + i, &a, 8);
+            }
+            for (; i < len; ++i) dst[i] ^= src[i];
+        }
+
+        // ---- scalar: four split-table lookups per symbol ----
+        void mul_add_scalar(std::byte* dst, const std::byte* src, const SplitTables& t, std::size_t len) noexcept {
+            for (std::size_t i = 0; i + 2 <= len; i += 2) {
+                const auto l = std::to_integer<std::uint8_t>(src[i]);
+                const auto h = std::to_integer<std::uint8_t>(src[i + 1]);
+                const std::uint8_t pl = t.lo[0][l & 0x0F] ^ t.lo[1][l >> 4] ^ t.lo[2][h & 0x0F] ^ t.lo[3][h >> 4];
+                const std::uint8_t ph = t.hi[0][l & 0x0F] ^ t.hi[1][l >> 4] ^ t.hi[2][h & 0x0F] ^ t.hi[3][h >> 4];
+                dst[i] ^= std::byte{ pl };
+                dst[i + 1] ^= std::byte{ ph };
+            }
+        }
+
+#if LTFEC_X86
+        // ---- SSSE3: 16 symbols (32 bytes) per step ----
+        // Low and high symbol bytes are split into separate registers with PACKUSWB, looked up
+        // nibble-wise with PSHUFB, and re-interleaved with PUNPCK{L,H}BW.
+        LTFEC_TARGET("ssse3")
+        std::size_t mul_add_ssse3(std::byte* dst, const std::byte* src, const SplitTables& t, std::size_t len) noexcept {
+            __m128i tl[4], th[4];
+            for (int k = 0; k < 4; ++k) {
+                tl[k] = _mm_load_si128(reinterpret_cast<const __m128i*>(t.lo[k]));
+                th[k] = _mm_load_si128(reinterpret_cast<const __m128i*>(t.hi[k]));
+            }
+            const __m128i mask = _mm_set1_epi8(0x0F);
+            const __m128i low8 = _mm_set1_epi16(0x00FF);
+            std::size_t i = 0;
+            for (; i + 32 <= len; i += 32) {
+                const __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+                const __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i + 16));
+                const __m128i l = _mm_packus_epi16(_mm_and_si128(a, low8), _mm_and_si128(b, low8));
+                const __m128i h = _mm_packus_epi16(_mm_srli_epi16(a, 8), _mm_srli_epi16(b, 8));
+                const __m128i n0 = _mm_and_si128(l, mask);
+                const __m128i n1 = _mm_and_si128(_mm_srli_epi64(l, 4), mask);
+                const __m128i n2 = _mm_and_si128(h, mask);
+                const __m128i n3 = _mm_and_si128(_mm_srli_epi64(h, 4), mask);
+                const __m128i pl = _mm_xor_si128(_mm_xor_si128(_mm_shuffle_epi8(tl[0], n0), _mm_shuffle_epi8(tl[1], n1)),
+                    _mm_xor_si128(_mm_shuffle_epi8(tl[2], n2), _mm_shuffle_epi8(tl[3], n3)));
+                const __m128i ph = _mm_xor_si128(_mm_xor_si128(_mm_shuffle_epi8(th[0], n0), _mm_shuffle_epi8(th[1], n1)),
+                    _mm_xor_si128(_mm_shuffle_epi8(th[2], n2), _mm_shuffle_epi8(th[3], n3)));
+                const __m128i d0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(dst + i));
+                const __m128i d1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(dst + i + 16));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm_xor_si128(d0, _mm_unpacklo_epi8(pl, ph)));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i + 16), _mm_xor_si128(d1, _mm_unpackhi_epi8(pl, ph)));
+            }
+            return i;
+        }
+
+        // ---- AVX2: 32 symbols (64 bytes) per step; pack/unpack are per-lane, so they still invert ----
+        LTFEC_TARGET("avx2")
+        std::size_t mul_add_avx2(std::byte* dst, const std::byte* src, const SplitTables& t, std::size_t len) noexcept {
+            __m256i tl[4], th[4];
+            for (int k = 0; k < 4; ++k) {
+                tl[k] = _mm256_broadcastsi128_si256(_mm_load_si128(reinterpret_cast<const __m128i*>(t.lo[k])));
+                th[k] = _mm256_broadcastsi128_si256(_mm_load_si128(reinterpret_cast<const __m128i*>(t.hi[k])));
+            }
+            const __m256i mask = _mm256_set1_epi8(0x0F);
+            const __m256i low8 = _mm256_set1_epi16(0x00FF);
+            std::size_t i = 0;
+            for (; i + 64 <= len; i += 64) {
+                const __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+                const __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i + 32));
+                const __m256i l = _mm256_packus_epi16(_mm256_and_si256(a, low8), _mm256_and_si256(b, low8));
+                const __m256i h = _mm256_packus_epi16(_mm256_srli_epi16(a, 8), _mm256_srli_epi16(b, 8));
+                const __m256i n0 = _mm256_and_si256(l, mask);
+                const __m256i n1 = _mm256_and_si256(_mm256_srli_epi64(l, 4), mask);
+                const __m256i n2 = _mm256_and_si256(h, mask);
+                const __m256i n3 = _mm256_and_si256(_mm256_srli_epi64(h, 4), mask);
+                const __m256i pl = _mm256_xor_si256(_mm256_xor_si256(_mm256_shuffle_epi8(tl[0], n0), _mm256_shuffle_epi8(tl[1], n1)),
+                    _mm256_xor_si256(_mm256_shuffle_epi8(tl[2], n2), _mm256_shuffle_epi8(tl[3], n3)));
+                const __m256i ph = _mm256_xor_si256(_mm256_xor_si256(_mm256_shuffle_epi8(th[0], n0), _mm256_shuffle_epi8(th[1], n1)),
+                    _mm256_xor_si256(_mm256_shuffle_epi8(th[2], n2), _mm256_shuffle_epi8(th[3], n3)));
+                const __m256i d0 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(dst + i));
+                const __m256i d1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(dst + i + 32));
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), _mm256_xor_si256(d0, _mm256_unpacklo_epi8(pl, ph)));
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i + 32), _mm256_xor_si256(d1, _mm256_unpackhi_epi8(pl, ph)));
+            }
+            return i;
+        }
+#endif
+
+        void mul_add_dispatch(std::byte* dst, const std::byte* src, std::uint16_t c, std::size_t len,
+            SimdLevel level) noexcept
+        {
+            len &= ~static_cast<std::size_t>(1);
+            if (c == 0 || len == 0) return;
+            if (c == 1) { xor_region(dst, src, len); return; }
+
+            SplitTables t;
+            make_split(c, t);
+            std::size_t done = 0;
+#if LTFEC_X86
+            if (level == SimdLevel::avx2) done = mul_add_avx2(dst, src, t, len);
+            if (level >= SimdLevel::ssse3) done += mul_add_ssse3(dst + done, src + done, t, len - done);
+#else
+            (void)level;
+#endif
+            mul_add_scalar(dst + done, src + done, t, len - done);
+        }
+
+    } // namespace
+
+    void gf65536_mul_add_region(std::byte* dst, const std::byte* src, std::uint16_t c, std::size_t len) noexcept {
+        static const SimdLevel level = ltfec::util::best_simd_level();
+        mul_add_dispatch(dst, src, c, len, level);
+    }
+
+    void gf65536_mul_add_region(std::byte* dst, const std::byte* src, std::uint16_t c, std::size_t len,
+        SimdLevel level) noexcept
+    {
+        mul_add_dispatch(dst, src, c, len, ltfec::util::clamp_simd_level(level));
+    }
+
+    void gf65536_mul_add_padded(std::byte* dst, const std::byte* src, std::uint16_t c, std::size_t len) noexcept {
+        gf65536_mul_add_region(dst, src, c, len);
+        if ((len & 1u) == 0) return;
+        const std::byte tail[2] = { src[len - 1], std::byte{ 0 } };
+        gf65536_mul_add_region(dst + len - 1, tail, c, 2);
+    }
+
+    void gf65536_mul_region(std::byte* dst, const std::byte* src, std::uint16_t c, std::size_t len) noexcept {
+        if (len == 0) return;
+        if (c == 0) { std::memset(dst, 0, len); return; }
+        if (c == 1) { if (dst != src) std::memmove(dst, src, len); return; }
+        if (dst == src) {
+            // In-place: scale through a small stack buffer so the kernel can accumulate into zeros.
+            alignas(32) std::byte tmp[256];
+            for (std::size_t off = 0; off < len; off += sizeof(tmp)) {
+                const std::size_t n = (len - off < sizeof(tmp)) ? (len - off) : sizeof(tmp);
+                std::memset(tmp, 0, n);
+                gf65536_mul_add_region(tmp, src + off, c, n);
+                std::memcpy(dst + off, tmp, n);
+            }
+            return;
+        }
+        std::memset(dst, 0, len);
+        gf65536_mul_add_region(dst, src, c, len);
+    }
+
+} // namespace ltfec::fec_core
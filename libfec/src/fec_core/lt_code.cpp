@@ -0,0 +1,63 @@
+#include <ltfec/fec_core/lt_code.h>
+#include <algorithm>
+#include <cmath>
+
+namespace ltfec::fec_core {
+
+    std::vector<std::uint32_t> lt_robust_soliton_cdf(std::size_t N, double c, double delta) {
+        std::vector<std::uint32_t> cdf(N, 0);
+        if (N == 0) return cdf;
+
+        // Ideal soliton rho plus the robust spike tau, normalized by beta.
+        const double n = static_cast<double>(N);
+        const double R = std::max(1.0, c * std::log(n / delta) * std::sqrt(n));
+        const auto spike = static_cast<std::size_t>(std::clamp(std::floor(n / R), 1.0, n));
+
+        std::vector<double> mu(N + 1, 0.0);
+        double beta = 0.0;
+        for (std::size_t d = 1; d <= N; ++d) {
+            const double rho = (d == 1) ? 1.0 / n : 1.0 / (static_cast<double>(d) * static_cast<double>(d - 1));
+            double tau = 0.0;
+            if (d < spike) tau = R / (static_cast<double>(d) * n);
+            else if (d == spike) tau = R * std::log(R / delta) / n;
+            mu[d] = rho + std::max(0.0, tau);
+            beta += mu[d];
+        }
+
+        double acc = 0.0;
+        for (std::size_t d = 1; d <= N; ++d) {
+            acc += mu[d] / beta;
+            cdf[d - 1] = static_cast<std::uint32_t>(std::min(1.0, acc) * 4294967295.0);
+        }
+        cdf[N - 1] = 0xFFFFFFFFu;
+        return cdf;
+    }
+
+    void lt_neighbors(std::uint32_t gen, std::uint32_t esi, std::size_t N,
+        std::span<const std::uint32_t> cdf, std::vector<std::uint16_t>& out)
+    {
+        out.clear();
+        if (N == 0 || cdf.size() < N) return;
+
+        // xorshift32 seeded from (gen, esi)
+        std::uint32_t x = (gen * 0x9E3779B1u) ^ (esi * 0x85EBCA6Bu) ^ 0xC2B2AE35u;
+        if (x == 0) x = 0xA3C59AC3u;
+        auto next = [&x]() {
+            x ^= x << 13;
+            x ^= x >> 17;
+            x ^= x << 5;
+            return x;
+        };
+
+        const std::uint32_t u = next();
+        const auto it = std::lower_bound(cdf.begin(), cdf.begin() + static_cast<std::ptrdiff_t>(N), u);
+        const std::size_t degree = static_cast<std::size_t>(it - cdf.begin()) + 1;
+
+        out.reserve(degree);
+        while (out.size() < degree) {
+            const auto s = static_cast<std::uint16_t>(next() % N);
+            if (std::find(out.begin(), out.end(), s) == out.end()) out.push_back(s);
+        }
+    }
+
+} // namespace ltfec::fec_core
@@ -0,0 +1,100 @@
+#include <ltfec/fec_core/xor_2d.h>
+#include <ltfec/fec_core/xor_region.h>
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+namespace ltfec::fec_core {
+
+    void xor2d_encode(std::span<const std::byte* const> data_frames,
+        std::size_t frame_len,
+        std::size_t columns,
+        std::span<std::byte*> parity_frames) noexcept
+    {
+        const std::size_t N = data_frames.size();
+        if (!xor2d_supports(N, parity_frames.size(), columns)) return;
+        const std::size_t D = N / columns;
+
+        // Columns: strided gather of D sources; rows: L contiguous sources.
+        std::vector<const std::byte*> srcs(std::max(columns, D));
+        for (std::size_t c = 0; c < columns; ++c) {
+            if (!parity_frames[c]) continue;
+            for (std::size_t r = 0; r < D; ++r) srcs[r] = data_frames[r * columns + c];
+            xor_regions(parity_frames[c], nullptr, std::span<const std::byte* const>(srcs.data(), D), frame_len);
+        }
+        for (std::size_t r = 0; r < D; ++r) {
+            if (!parity_frames[columns + r]) continue;
+            xor_regions(parity_frames[columns + r], nullptr, data_frames.subspan(r * columns, columns), frame_len);
+        }
+    }
+
+    std::size_t xor2d_peel(std::span<std::byte* const> syndromes,
+        std::size_t frame_len,
+        std::size_t columns,
+        std::span<std::uint8_t> missing,
+        std::span<std::byte* const> out) noexcept
+    {
+        const std::size_t N = missing.size();
+        const std::size_t K = syndromes.size();
+        if (!xor2d_supports(N, K, columns) || out.size() < N) return 0;
+
+        std::size_t recovered = 0;
+        bool progress = true;
+        while (progress) {
+            progress = false;
+            for (std::size_t j = 0; j < K; ++j) {
+                if (!syndromes[j]) continue;
+
+                // A line with exactly one missing member: its syndrome is that frame.
+                std::size_t count = 0, d_miss = 0;
+                for (std::size_t d = 0; d < N && count < 2; ++d) {
+                    if (missing[d] && xor2d_in_line(j, d, columns)) { ++count; d_miss = d; }
+                }
+                if (count != 1) continue;
+
+                std::memcpy(out[d_miss], syndromes[j], frame_len);
+                missing[d_miss] = 0;
+                ++recovered;
+                progress = true;
+
+                // Fold the recovered frame out of the crossing line.
+                const std::size_t other = (j < columns) ? columns + d_miss / columns : d_miss % columns;
+                if (syndromes[other]) {
+                    const std::byte* src[1] = { out[d_miss] };
+                    xor_regions(syndromes[other], syndromes[other], std::span<const std::byte* const>(src, 1), frame_len);
+                }
+            }
+        }
+        return recovered;
+    }
+
+    std::size_t xor2d_recover(std::span<const std::byte* const> data_ptrs,
+        std::span<const std::byte* const> parity_ptrs,
+        std::size_t frame_len,
+        std::size_t columns,
+        std::span<std::byte* const> out) noexcept
+    {
+        const std::size_t N = data_ptrs.size();
+        const std::size_t K = parity_ptrs.size();
+        if (!xor2d_supports(N, K, columns) || out.size() < N) return 0;
+
+        std::vector<std::uint8_t> missing(N);
+        for (std::size_t d = 0; d < N; ++d) missing[d] = data_ptrs[d] == nullptr;
+
+        std::vector<std::byte> buf(K * frame_len);
+        std::vector<std::byte*> syn(K, nullptr);
+        std::vector<const std::byte*> srcs;
+        for (std::size_t j = 0; j < K; ++j) {
+            if (!parity_ptrs[j]) continue;
+            srcs.clear();
+            for (std::size_t d = 0; d < N; ++d) {
+                if (data_ptrs[d] && xor2d_in_line(j, d, columns)) srcs.push_back(data_ptrs[d]);
+            }
+            syn[j] = buf.data() + j * frame_len;
+            xor_regions(syn[j], parity_ptrs[j], std::span<const std::byte* const>(srcs.data(), srcs.size()), frame_len);
+        }
+        return xor2d_peel(std::span<std::byte* const>(syn.data(), K), frame_len, columns,
+            std::span<std::uint8_t>(missing.data(), N), out);
+    }
+
+} // namespace ltfec::fec_core
@@ -1,4 +1,5 @@
 #include <ltfec/fec_core/xor_parity.h>
+#include <ltfec/fec_core/xor_region.h>
 #include <algorithm>
 #include <cassert>
 
@@ -23,16 +24,8 @@ namespace ltfec::fec_core {
         // Clamp to provided parity buffer size for safety.
         const std::size_t len = std::min<std::size_t>(frame_len, out_parity.size());
 
-        // Start with zeros.
-        std::fill_n(out_parity.begin(), len, std::byte{ 0 });
-
-        // XOR each frame into the parity buffer.
-        for (const std::byte* frame : data_frames) {
-            if (!frame) continue; // tolerate null pointers defensively
-            for (std::size_t i = 0; i < len; ++i) {
-                out_parity[i] ^= frame[i];
-            }
-        }
+        // Zero seed, then fold all frames (null pointers skipped) in as few passes as possible.
+        xor_regions(out_parity.data(), nullptr, data_frames, len);
     }
 
 } // namespace ltfec::fec_core
\ No newline at end of file
@@ -0,0 +1,151 @@
+#include <ltfec/fec_core/xor_region.h>
+#include <ltfec/util/crc32c.h>
+#include <algorithm>
+#include <array>
+#include <cstring>
+
+#if LTFEC_X86
+#include <immintrin.h>
+#endif
+
+namespace ltfec::fec_core {
+
+    using ltfec::util::SimdLevel;
+
+    namespace {
+
+        // One pass: dst[i] = base[i] ^ s[0][i] ^ ... ^ s[S-1][i] for i in [from, len).
+        // base is either the seed, dst itself (accumulate) or nullptr (zeros).
+        template <int S>
+        void fold_scalar(std::byte* dst, const std::byte* base, const std::byte* const* s,
+            std::size_t from, std::size_t len) noexcept
+        {
+            std::size_t i = from;
+            for (; i + 8 <= len; i += 8) {
+                std::uint64_t acc = 0;
+                if (base) std::memcpy(&acc, base + i, 8);
+                for (int k = 0; k < S; ++k) {
+                    std::uint64_t w;
+                    std::memcpy(&w, s[k] + i, 8);
+                    acc ^= w;
+                }
+                std::memcpy(dst + i, &acc, 8);
+            }
+            for (; i < len; ++i) {
+                std::byte acc = base ? base[i] : std::byte{ 0 };
+                for (int k = 0; k < S; ++k) acc ^= s[k][i];
+                dst[i] = acc;
+            }
+        }
+
+#if LTFEC_X86
+        template <int S>
+        LTFEC_TARGET("sse2")
+        std::size_t fold_sse2(std::byte* dst, const std::byte* base, const std::byte* const* s, std::size_t len) noexcept {
+            std::size_t i = 0;
+            for (; i + 16 <= len; i += 16) {
+                __m128i acc = base ? _mm_loadu_si128(reinterpret_cast<const __m128i*>(base + i)) : _mm_setzero_si128();
+                for (int k = 0; k < S; ++k)
+                    acc = _mm_xor_si128(acc, _mm_loadu_si128(reinterpret_cast<const __m128i*>(s[k] + i)));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), acc);
+            }
+            return i;
+        }
+
+        template <int S>
+        LTFEC_TARGET("avx2")
+        std::size_t fold_avx2(std::byte* dst, const std::byte* base, const std::byte* const* s, std::size_t len) noexcept {
+            std::size_t i = 0;
+            for (; i + 32 <= len; i += 32) {
+                __m256i acc = base ? _mm256_loadu_si256(reinterpret_cast<const __m256i*>(base + i)) : _mm256_setzero_si256();
+                for (int k = 0; k < S; ++k)
+                    acc = _mm256_xor_si256(acc, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(s[k] + i)));
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), acc);
+            }
+            return i;
+        }
+#endif
+
+        template <int S>
+        void fold(std::byte* dst, const std::byte* base, const std::byte* const* s, std::size_t len,
+            SimdLevel level) noexcept
+        {
+            std::size_t done = 0;
+#if LTFEC_X86
+            if (level == SimdLevel::avx2) done = fold_avx2<S>(dst, base, s, len);
+            else if (level == SimdLevel::ssse3) done = fold_sse2<S>(dst, base, s, len);
+#else
+            (void)level;
+#endif
+            fold_scalar<S>(dst, base, s, done, len);
+        }
+
+        using FoldFn = void (*)(std::byte*, const std::byte*, const std::byte* const*, std::size_t, SimdLevel) noexcept;
+
+        constexpr std::array<FoldFn, kXorFoldWidth + 1> kFold = {
+            nullptr, &fold<1>, &fold<2>, &fold<3>, &fold<4>, &fold<5>, &fold<6>, &fold<7>, &fold<8>,
+        };
+
+        void xor_regions_impl(std::byte* dst, const std::byte* seed,
+            std::span<const std::byte* const> srcs, std::size_t len, SimdLevel level) noexcept
+        {
+            if (len == 0) return;
+
+            // First pass reads the seed (or zeros); later passes accumulate into dst.
+            const std::byte* base = seed;
+            std::array<const std::byte*, kXorFoldWidth> group{};
+            std::size_t n = 0;
+            bool wrote = false;
+
+            for (const std::byte* p : srcs) {
+                if (!p) continue;
+                group[n++] = p;
+                if (n == kXorFoldWidth) {
+                    kFold[n](dst, base, group.data(), len, level);
+                    base = dst; n = 0; wrote = true;
+                }
+            }
+            if (n > 0) {
+                kFold[n](dst, base, group.data(), len, level);
+                wrote = true;
+            }
+            if (!wrote) {
+                // No sources: dst = seed (or zeros).
+                if (!seed) std::memset(dst, 0, len);
+                else if (seed != dst) std::memmove(dst, seed, len);
+            }
+        }
+
+    } // namespace
+
+    void xor_regions(std::byte* dst, const std::byte* seed,
+        std::span<const std::byte* const> srcs, std::size_t len) noexcept
+    {
+        static const SimdLevel level = ltfec::util::best_simd_level();
+        xor_regions_impl(dst, seed, srcs, len, level);
+    }
+
+    void xor_regions(std::byte* dst, const std::byte* seed,
+        std::span<const std::byte* const> srcs, std::size_t len, SimdLevel level) noexcept
+    {
+        xor_regions_impl(dst, seed, srcs, len, ltfec::util::clamp_simd_level(level));
+    }
+
+    std::uint32_t copy_xor_crc32c(std::byte* dst, std::byte* acc, const std::byte* src,
+        std::size_t len, std::uint32_t crc_state) noexcept
+    {
+        // Chunk small enough that the copy, the XOR and the CRC all find it in L1.
+        constexpr std::size_t kChunk = 2048;
+        static const SimdLevel level = ltfec::util::best_simd_level();
+
+        for (std::size_t off = 0; off < len; off += kChunk) {
+            const std::size_t n = std::min(kChunk, len - off);
+            const std::byte* s = src + off;
+            if (dst) std::memcpy(dst + off, s, n);
+            if (acc) kFold[1](acc + off, acc + off, &s, n, level);
+            crc_state = ltfec::util::crc32c_update(crc_state, std::span<const std::byte>(s, n));
+        }
+        return crc_state;
+    }
+
+} // namespace ltfec::fec_core
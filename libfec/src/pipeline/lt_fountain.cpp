@@ -0,0 +1,211 @@
+#include <ltfec/pipeline/lt_fountain.h>
+#include <ltfec/fec_core/lt_code.h>
+#include <ltfec/fec_core/xor_region.h>
+#include <ltfec/protocol/ids.h>
+#include <algorithm>
+#include <utility>
+
+namespace ltfec::pipeline {
+    using namespace ltfec::protocol;
+
+    // ---------------- Encoder ----------------
+
+    LtEncoder::LtEncoder(LtConfig cfg) : cfg_(cfg) {}
+
+    bool LtEncoder::start_object(std::uint32_t gen, const std::vector<std::span<const std::byte>>& sources) noexcept {
+        N_ = 0;
+        if (sources.empty() || sources.size() > LtConfig::kMaxSources) return false;
+        const std::size_t L = sources[0].size();
+        if (L == 0) return false;
+        if (cfg_.max_payload_len && L > cfg_.max_payload_len) return false;
+        for (const auto& s : sources) if (s.size() != L) return false;
+
+        sources_.resize(sources.size());
+        for (std::size_t i = 0; i < sources.size(); ++i) sources_[i].assign(sources[i].begin(), sources[i].end());
+        if (sources.size() != cdf_.size()) cdf_ = fec_core::lt_robust_soliton_cdf(sources.size());
+
+        gen_ = gen;
+        N_ = static_cast<std::uint16_t>(sources.size());
+        payload_len_ = L;
+        next_esi_ = 0;
+        return true;
+    }
+
+    bool LtEncoder::encode_symbol(std::uint16_t esi, std::vector<std::byte>& out_frame) noexcept {
+        if (N_ == 0) return false;
+
+        BaseHeader h{};
+        h.version = k_protocol_version;
+        h.flags1 = k_flags1_fountain;
+        h.flags2 = flags2_pack_parity_count_minus_one(1);
+        h.fec_gen_id = gen_;
+        h.seq_in_block = esi;
+        h.data_count = N_;
+        h.parity_count = 1;
+        h.payload_len = static_cast<std::uint16_t>(payload_len_);
+
+        if (esi < N_) {
+            const auto& src = sources_[esi];
+            out_frame.resize(encoded_size(payload_len_, /*parity*/false));
+            return encode_data_frame(std::span<std::byte>(out_frame.data(), out_frame.size()), h,
+                std::span<const std::byte>(src.data(), src.size()));
+        }
+
+        fec_core::lt_neighbors(gen_, esi, N_, cdf_, neighbors_);
+        srcs_.clear();
+        for (const auto s : neighbors_) srcs_.push_back(sources_[s].data());
+        symbol_.resize(payload_len_);
+        fec_core::xor_regions(symbol_.data(), nullptr, srcs_, payload_len_);
+
+        ParitySubheader ps{};
+        ps.fec_scheme_id = static_cast<std::uint8_t>(fec_scheme_id::lt_fountain);
+        ps.fec_parity_index = static_cast<std::uint8_t>(esi & 0xFFu);
+
+        out_frame.resize(encoded_size(payload_len_, /*parity*/true));
+        return encode_parity_frame(std::span<std::byte>(out_frame.data(), out_frame.size()), h, ps,
+            std::span<const std::byte>(symbol_.data(), symbol_.size()));
+    }
+
+    bool LtEncoder::next_frame(std::vector<std::byte>& out_frame) noexcept {
+        if (next_esi_ > 0xFFFFu) return false; // ESI space exhausted
+        if (!encode_symbol(static_cast<std::uint16_t>(next_esi_), out_frame)) return false;
+        ++next_esi_;
+        return true;
+    }
+
+    // ---------------- Decoder ----------------
+
+    LtDecoder::LtDecoder(LtConfig cfg) : cfg_(cfg) {}
+
+    void LtDecoder::reset() {
+        bound_ = false;
+        N_ = 0;
+        payload_len_ = 0;
+        known_count_ = 0;
+        received_ = 0;
+        pending_ = 0;
+        sources_.clear();
+        have_.clear();
+        recovered_.clear();
+        seen_repair_.clear();
+        symbols_.clear();
+        waiting_.clear();
+    }
+
+    void LtDecoder::resolve(std::uint16_t src, std::vector<std::byte> value, bool recovered) {
+        // Worklist of (source, value) pairs that just became known.
+        std::vector<std::pair<std::uint16_t, std::vector<std::byte>>> work;
+        work.emplace_back(src, std::move(value));
+
+        bool first = true;
+        while (!work.empty()) {
+            auto [s, v] = std::move(work.back());
+            work.pop_back();
+            const bool rec = first ? recovered : true; // everything released by peeling is reconstructed
+            first = false;
+            if (have_[s]) continue;
+
+            have_[s] = true;
+            recovered_[s] = rec;
+            sources_[s] = std::move(v);
+            ++known_count_;
+
+            const std::byte* sv = sources_[s].data();
+            for (const std::uint32_t idx : waiting_[s]) {
+                Symbol& sym = symbols_[idx];
+                auto it = std::find(sym.unknown.begin(), sym.unknown.end(), s);
+                if (it == sym.unknown.end()) continue; // already released
+                fec_core::xor_regions(sym.value.data(), sym.value.data(), std::span<const std::byte* const>(&sv, 1), payload_len_);
+                sym.unknown.erase(it);
+                if (sym.unknown.size() == 1) {
+                    const std::uint16_t next = sym.unknown[0];
+                    sym.unknown.clear();
+                    --pending_;
+                    if (!have_[next]) work.emplace_back(next, std::move(sym.value));
+                    sym.value = {};
+                }
+            }
+            waiting_[s].clear();
+            waiting_[s].shrink_to_fit();
+        }
+    }
+
+    bool LtDecoder::ingest(const BaseHeader& h,
+        bool has_parity_sub,
+        const ParitySubheader& ps,
+        std::span<const std::byte> payload)
+    {
+        if ((h.flags1 & k_flags1_fountain) == 0) return false;
+        if (payload.empty()) return false;
+        if (cfg_.max_payload_len && payload.size() > cfg_.max_payload_len) return false;
+        if (h.data_count == 0 || h.data_count > LtConfig::kMaxSources) return false;
+
+        if (!bound_) {
+            bound_ = true;
+            gen_ = h.fec_gen_id;
+            N_ = h.data_count;
+            payload_len_ = payload.size();
+            sources_.assign(N_, {});
+            have_.assign(N_, false);
+            recovered_.assign(N_, false);
+            seen_repair_.assign(0x10000u - N_, false);
+            waiting_.assign(N_, {});
+            cdf_ = fec_core::lt_robust_soliton_cdf(N_);
+        }
+        else if (h.fec_gen_id != gen_ || h.data_count != N_ || payload.size() != payload_len_) {
+            return false;
+        }
+
+        const std::uint16_t esi = h.seq_in_block;
+        if (!has_parity_sub) {
+            if (esi >= N_) return false;
+            ++received_;
+            if (!have_[esi]) resolve(esi, std::vector<std::byte>(payload.begin(), payload.end()), /*recovered*/false);
+            return true;
+        }
+
+        if (ps.fec_scheme_id != static_cast<std::uint8_t>(fec_scheme_id::lt_fountain)) return false;
+        if (esi < N_) return false;
+        ++received_;
+        if (complete() || seen_repair_[esi - N_]) return true; // nothing left to learn / duplicate
+        seen_repair_[esi - N_] = true;
+
+        // Reduce by every source already known in one multi-source XOR pass.
+        fec_core::lt_neighbors(gen_, esi, N_, cdf_, neighbors_);
+        Symbol sym;
+        srcs_.clear();
+        for (const auto s : neighbors_) {
+            if (have_[s]) srcs_.push_back(sources_[s].data());
+            else sym.unknown.push_back(s);
+        }
+        if (sym.unknown.empty()) return true; // redundant
+
+        sym.value.resize(payload_len_);
+        fec_core::xor_regions(sym.value.data(), payload.data(), srcs_, payload_len_);
+
+        if (sym.unknown.size() == 1) {
+            resolve(sym.unknown[0], std::move(sym.value), /*recovered*/true);
+            return true;
+        }
+
+        const auto idx = static_cast<std::uint32_t>(symbols_.size());
+        for (const auto s : sym.unknown) waiting_[s].push_back(idx);
+        symbols_.push_back(std::move(sym));
+        ++pending_;
+        return true;
+    }
+
+    bool LtDecoder::extract(RxClosedBlock& out) {
+        if (!complete()) return false;
+        out.gen = gen_;
+        out.N = N_;
+        out.K = 0;
+        out.payload_len = static_cast<std::uint16_t>(payload_len_);
+        out.data = std::move(sources_);
+        out.was_recovered = std::move(recovered_);
+        out.delivered.assign(N_, false);
+        reset();
+        return true;
+    }
+
+} // namespace ltfec::pipeline
@@ -0,0 +1,273 @@
+#include <ltfec/pipeline/sliding_window.h>
+#include <ltfec/fec_core/gf256_field.h>
+#include <ltfec/fec_core/gf256_region.h>
+#include <ltfec/fec_core/rlc.h>
+#include <ltfec/protocol/ids.h>
+#include <algorithm>
+#include <cstring>
+
+namespace ltfec::pipeline {
+    using namespace ltfec::protocol;
+
+    namespace {
+        // Serial-number order for 32-bit ESIs (valid while compared values are < 2^31 apart).
+        bool esi_before(std::uint32_t a, std::uint32_t b) noexcept {
+            return static_cast<std::int32_t>(a - b) < 0;
+        }
+    } // namespace
+
+    // ---------------- Encoder ----------------
+
+    SlidingWindowEncoder::SlidingWindowEncoder(SlidingWindowConfig cfg, std::uint32_t first_esi)
+        : cfg_(cfg), next_esi_(first_esi), window_(cfg.W), coefs_(cfg.W)
+    {
+    }
+
+    bool SlidingWindowEncoder::push_data(std::span<const std::byte> payload,
+        std::vector<std::vector<std::byte>>& out_frames) noexcept
+    {
+        out_frames.clear();
+        if (!cfg_.valid()) return false;
+        const std::size_t L = payload.size();
+        if (L == 0) return false;
+        if (cfg_.max_payload_len && L > cfg_.max_payload_len) return false;
+        if (payload_len_ == 0) payload_len_ = L;
+        else if (L != payload_len_) return false;
+
+        const std::uint32_t esi = next_esi_;
+        const std::uint16_t W = cfg_.W;
+
+        // Source frame
+        BaseHeader h{};
+        h.version = k_protocol_version;
+        h.flags1 = k_flags1_sliding_window;
+        h.flags2 = flags2_pack_parity_count_minus_one(1);
+        h.fec_gen_id = esi;
+        h.seq_in_block = 0;
+        h.data_count = W;
+        h.parity_count = 1;
+        h.payload_len = static_cast<std::uint16_t>(L);
+
+        out_frames.resize(1);
+        out_frames[0].resize(encoded_size(L, /*parity*/false));
+        if (!encode_data_frame(std::span<std::byte>(out_frames[0].data(), out_frames[0].size()), h, payload)) {
+            out_frames.clear();
+            return false;
+        }
+
+        // Indexed by the push count, not the ESI: 2^32 is not a multiple of every W.
+        window_[pushed_ % W].assign(payload.begin(), payload.end());
+        ++next_esi_;
+        ++pushed_;
+        if (++since_repair_ < cfg_.R) return true;
+        since_repair_ = 0;
+
+        // Repair frame over the last w sources
+        const auto w = static_cast<std::uint16_t>(std::min<std::uint64_t>(W, pushed_));
+        const std::uint32_t first = next_esi_ - w;
+        const std::uint8_t key = repair_key_++;
+        fec_core::rlc_coefficients(first, key, std::span<std::uint8_t>(coefs_.data(), w));
+
+        repair_.assign(L, std::byte{ 0 });
+        for (std::uint16_t i = 0; i < w; ++i) {
+            fec_core::gf256_mul_add_region(repair_.data(), window_[(pushed_ - w + i) % W].data(), coefs_[i], L);
+        }
+
+        h.fec_gen_id = first;
+        h.seq_in_block = w;
+        h.data_count = w;
+
+        ParitySubheader ps{};
+        ps.fec_scheme_id = static_cast<std::uint8_t>(fec_scheme_id::rlc_sliding);
+        ps.fec_parity_index = key;
+
+        out_frames.resize(2);
+        out_frames[1].resize(encoded_size(L, /*parity*/true));
+        return encode_parity_frame(std::span<std::byte>(out_frames[1].data(), out_frames[1].size()), h, ps,
+            std::span<const std::byte>(repair_.data(), repair_.size()));
+    }
+
+    // ---------------- Decoder ----------------
+
+    SlidingWindowDecoder::SlidingWindowDecoder(SlidingWindowConfig cfg)
+        : cfg_(cfg), slots_(2u * cfg.W)
+    {
+    }
+
+    bool SlidingWindowDecoder::in_horizon(std::uint32_t esi) const noexcept {
+        return started_ && !esi_before(highest_, esi) && (highest_ - esi) < slots_.size();
+    }
+
+    std::size_t SlidingWindowDecoder::slot_of(std::uint32_t esi) const noexcept {
+        // Unwrapped ESI, so slots keep their order across the 32-bit wrap whatever the window size.
+        return static_cast<std::size_t>((top_ - (highest_ - esi)) % slots_.size());
+    }
+
+    const SlidingWindowDecoder::Slot* SlidingWindowDecoder::known(std::uint32_t esi) const noexcept {
+        if (!in_horizon(esi)) return nullptr;
+        const Slot& s = slots_[slot_of(esi)];
+        return (s.valid && s.esi == esi) ? &s : nullptr;
+    }
+
+    void SlidingWindowDecoder::advance(std::uint32_t esi) {
+        if (started_ && !esi_before(highest_, esi)) return;
+        top_ = started_ ? top_ + (esi - highest_) : esi;
+        started_ = true;
+        highest_ = esi;
+
+        // Equations still waiting on a source that fell out of the horizon can never be used.
+        std::erase_if(rows_, [&](const Row& r) {
+            return std::any_of(r.terms.begin(), r.terms.end(), [&](const Term& t) { return !in_horizon(t.esi); });
+        });
+    }
+
+    void SlidingWindowDecoder::store(std::uint32_t esi, std::span<const std::byte> payload, bool recovered,
+        std::vector<RxSourceFrame>& out)
+    {
+        Slot& s = slots_[slot_of(esi)];
+        s.esi = esi;
+        s.valid = true;
+        s.data.assign(payload.begin(), payload.end());
+
+        RxSourceFrame f;
+        f.esi = esi;
+        f.payload = s.data;
+        f.was_recovered = recovered;
+        out.push_back(std::move(f));
+    }
+
+    void SlidingWindowDecoder::axpy(Row& dst, const Row& src, std::uint8_t c) const {
+        // dst += c * src, merging the sorted term lists and dropping cancelled terms.
+        std::vector<Term> merged;
+        merged.reserve(dst.terms.size() + src.terms.size());
+        auto a = dst.terms.begin();
+        auto b = src.terms.begin();
+        while (a != dst.terms.end() || b != src.terms.end()) {
+            if (b == src.terms.end() || (a != dst.terms.end() && esi_before(a->esi, b->esi))) {
+                merged.push_back(*a++);
+            }
+            else if (a == dst.terms.end() || esi_before(b->esi, a->esi)) {
+                merged.push_back({ b->esi, fec_core::gf256::mul(c, b->coef) });
+                ++b;
+            }
+            else {
+                const std::uint8_t v = fec_core::gf256::add(a->coef, fec_core::gf256::mul(c, b->coef));
+                if (v) merged.push_back({ a->esi, v });
+                ++a; ++b;
+            }
+        }
+        dst.terms = std::move(merged);
+        fec_core::gf256_mul_add_region(dst.rhs.data(), src.rhs.data(), c, payload_len_);
+    }
+
+    void SlidingWindowDecoder::insert(Row e) {
+        auto coef_of = [](const Row& r, std::uint32_t esi) -> std::uint8_t {
+            for (const auto& t : r.terms) if (t.esi == esi) return t.coef;
+            return 0;
+        };
+
+        // Eliminate existing pivots from the new row.
+        for (const auto& r : rows_) {
+            if (const std::uint8_t c = coef_of(e, r.terms[0].esi)) axpy(e, r, c);
+        }
+        if (e.terms.empty()) return; // linearly dependent: adds nothing
+
+        // Normalize so the pivot coefficient is 1.
+        const std::uint8_t s = fec_core::gf256::inv(e.terms[0].coef);
+        for (auto& t : e.terms) t.coef = fec_core::gf256::mul(t.coef, s);
+        fec_core::gf256_mul_region(e.rhs.data(), e.rhs.data(), s, payload_len_);
+
+        // Eliminate the new pivot from every other row.
+        const std::uint32_t p = e.terms[0].esi;
+        for (auto& r : rows_) {
+            if (const std::uint8_t c = coef_of(r, p)) axpy(r, e, c);
+        }
+        rows_.push_back(std::move(e));
+    }
+
+    void SlidingWindowDecoder::substitute(std::uint32_t esi, std::span<const std::byte> value) {
+        // Move a newly known source to the right-hand side; rows that lose their pivot are re-inserted.
+        std::vector<Row> reinsert;
+        for (auto it = rows_.begin(); it != rows_.end();) {
+            auto t = std::find_if(it->terms.begin(), it->terms.end(), [&](const Term& x) { return x.esi == esi; });
+            if (t == it->terms.end()) { ++it; continue; }
+            fec_core::gf256_mul_add_region(it->rhs.data(), value.data(), t->coef, payload_len_);
+            const bool was_pivot = (t == it->terms.begin());
+            it->terms.erase(t);
+            if (was_pivot) {
+                if (!it->terms.empty()) reinsert.push_back(std::move(*it));
+                it = rows_.erase(it);
+            }
+            else {
+                ++it;
+            }
+        }
+        for (auto& r : reinsert) insert(std::move(r));
+    }
+
+    void SlidingWindowDecoder::harvest(std::vector<RxSourceFrame>& out) {
+        // A row reduced to its pivot alone is a solved source. In reduced echelon form no other
+        // row references that pivot, so no further substitution is needed.
+        for (auto it = rows_.begin(); it != rows_.end();) {
+            if (it->terms.size() != 1) { ++it; continue; }
+            const std::uint32_t esi = it->terms[0].esi;
+            Row r = std::move(*it);
+            it = rows_.erase(it);
+            store(esi, std::span<const std::byte>(r.rhs.data(), r.rhs.size()), /*recovered*/true, out);
+        }
+    }
+
+    bool SlidingWindowDecoder::ingest(const BaseHeader& h,
+        bool has_parity_sub,
+        const ParitySubheader& ps,
+        std::span<const std::byte> payload,
+        std::vector<RxSourceFrame>& out)
+    {
+        if (!cfg_.valid()) return false;
+        if ((h.flags1 & k_flags1_sliding_window) == 0) return false;
+        if (payload.empty()) return false;
+        if (cfg_.max_payload_len && payload.size() > cfg_.max_payload_len) return false;
+        if (payload_len_ == 0) payload_len_ = payload.size();
+        else if (payload.size() != payload_len_) return false;
+
+        if (!has_parity_sub) {
+            const std::uint32_t esi = h.fec_gen_id;
+            advance(esi);
+            if (!in_horizon(esi) || known(esi)) return true; // too old or duplicate
+            store(esi, payload, /*recovered*/false, out);
+            substitute(esi, payload);
+            harvest(out);
+            return true;
+        }
+
+        if (ps.fec_scheme_id != static_cast<std::uint8_t>(fec_scheme_id::rlc_sliding)) return false;
+        const std::uint32_t first = h.fec_gen_id;
+        const std::uint16_t w = h.data_count;
+        if (w == 0 || w > cfg_.W) return false;
+
+        advance(first + w - 1u);
+        if (!in_horizon(first)) return true; // covers sources we already gave up on
+
+        std::vector<std::uint8_t> coefs(w);
+        fec_core::rlc_coefficients(first, ps.fec_parity_index, std::span<std::uint8_t>(coefs));
+
+        // Reduce by every source already known; the rest become the row's unknowns.
+        Row e;
+        e.rhs.assign(payload.begin(), payload.end());
+        for (std::uint16_t i = 0; i < w; ++i) {
+            const std::uint32_t esi = first + i;
+            if (const Slot* s = known(esi)) {
+                fec_core::gf256_mul_add_region(e.rhs.data(), s->data.data(), coefs[i], payload_len_);
+            }
+            else {
+                e.terms.push_back({ esi, coefs[i] });
+            }
+        }
+        if (e.terms.empty()) return true; // nothing lost in this window
+
+        insert(std::move(e));
+        harvest(out);
+        return true;
+    }
+
+} // namespace ltfec::pipeline
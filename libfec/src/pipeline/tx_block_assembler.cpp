@@ -1,26 +1,206 @@
 #include <ltfec/pipeline/tx_block_assembler.h>
 #include <ltfec/fec_core/xor_parity.h>
+#include <ltfec/fec_core/xor_region.h>
+#include <ltfec/util/endian.h>
 #include <algorithm>
 #include <cstring>
 
 namespace ltfec::pipeline {
     using namespace ltfec::protocol;
 
-    bool TxBlockAssembler::assemble_block(const std::vector<std::span<const std::byte>>& data_payloads,
-        std::vector<std::vector<std::byte>>& out_frames) noexcept
+    std::uint8_t TxBlockAssembler::wire_columns() const noexcept {
+        // Only 2D XOR blocks advertise L in flags2; everything else keeps the high byte zero.
+        return enc_.pick_scheme_id() == static_cast<std::uint8_t>(fec_scheme_id::xor_2d) ? cfg_.columns : 0;
+    }
+
+    bool TxBlockAssembler::compact_header() const noexcept {
+        return cfg_.wire_version == k_protocol_version_v2 && wire_columns() == 0
+            && cfg_.N >= 1 && cfg_.N <= HeaderV2::kMaxData && cfg_.K <= HeaderV2::kMaxParity;
+    }
+
+    std::size_t TxBlockAssembler::header_size() const noexcept {
+        return compact_header() ? header_v2_size(/*explicit_len*/false) : FrameSizes::kBase;
+    }
+
+    std::size_t TxBlockAssembler::frame_size(std::size_t payload_len, bool parity) const noexcept {
+        return compact_header() ? encoded_size_v2(payload_len, parity) : encoded_size(payload_len, parity);
+    }
+
+    bool TxBlockAssembler::write_header(std::span<std::byte> out, const BaseHeader& h) const noexcept {
+        // Every frame is its own datagram, so v2 headers leave payload_len implicit.
+        return compact_header() ? write_header_v2(out, h, /*explicit_len*/false) : write_base_header(out, h);
+    }
+
+    bool TxBlockAssembler::fuses_parity() const noexcept {
+        // K=0 also picks xor_k1 as a sentinel, but has no accumulator to fold into.
+        return cfg_.K == 1 && enc_.pick_scheme_id() == static_cast<std::uint8_t>(fec_scheme_id::xor_k1);
+    }
+
+    bool TxBlockAssembler::emit_data_frame(std::uint32_t gen, std::uint16_t index,
+        std::span<const std::byte> payload, std::byte* acc, std::uint32_t* crc_out, std::vector<std::byte>& f) const noexcept
+    {
+        f.resize(frame_size(payload.size(), /*parity*/false));
+        return write_data_frame(gen, index, payload, acc, crc_out, std::span<std::byte>(f.data(), f.size()));
+    }
+
+    bool TxBlockAssembler::write_data_frame(std::uint32_t gen, std::uint16_t index,
+        std::span<const std::byte> payload, std::byte* acc, std::uint32_t* crc_out, std::span<std::byte> out) const noexcept
+    {
+        // Same layout as encode_data_frame, but the payload is read once: the copy into the frame,
+        // the CRC and (XOR parity) the fold into acc all happen in one pass.
+        if (out.size() < frame_size(payload.size(), /*parity*/false)) return false;
+        const std::size_t hs = header_size();
+        return write_data_parts(gen, index, payload, out.data() + hs, acc, crc_out,
+            out.first(hs), out.subspan(hs + payload.size(), FrameSizes::kCrcTrailer));
+    }
+
+    bool TxBlockAssembler::write_data_parts(std::uint32_t gen, std::uint16_t index,
+        std::span<const std::byte> payload, std::byte* copy_to, std::byte* acc, std::uint32_t* crc_out,
+        std::span<std::byte> header, std::span<std::byte> trailer) const noexcept
+    {
+        BaseHeader h{};
+        h.version = k_protocol_version;
+        h.flags1 = 0;
+        h.flags2 = flags2_pack_columns(flags2_pack_parity_count_minus_one(cfg_.K), wire_columns());
+        h.fec_gen_id = gen;
+        h.seq_in_block = index;          // data index
+        h.data_count = cfg_.N;
+        h.parity_count = cfg_.K;
+        h.payload_len = static_cast<std::uint16_t>(payload.size());
+
+        if (!write_header(header, h)) return false;
+        const std::uint32_t crc = ltfec::util::crc32c_finish(ltfec::fec_core::copy_xor_crc32c(
+            copy_to, acc, payload.data(), payload.size(), ltfec::util::crc32c_init()));
+        ltfec::util::endian::write_u32_le(trailer, crc);
+        if (crc_out) *crc_out = crc;
+        return true;
+    }
+
+    std::uint32_t TxBlockAssembler::xor_parity_crc(std::span<std::uint32_t> crcs,
+        std::span<const std::uint16_t> lengths, std::size_t width) noexcept
+    {
+        // Parity = XOR of the payloads zero-padded to width, so its CRC follows from theirs:
+        // padding extends crc(D) to crc(D || 0^pad) = crc32c_combine(crc(D), crc32c_zeros(pad), pad).
+        for (std::size_t i = 0; i < lengths.size() && i < crcs.size(); ++i) {
+            const std::size_t pad = width - lengths[i];
+            if (pad) crcs[i] = ltfec::util::crc32c_combine(crcs[i], ltfec::util::crc32c_zeros(pad), pad);
+        }
+        return ltfec::util::crc32c_xor_of(crcs, width);
+    }
+
+    bool TxBlockAssembler::emit_parity_frame(std::uint32_t gen, std::uint16_t index, std::uint8_t scheme,
+        std::span<const std::byte> parity, std::span<const std::uint16_t> lengths, const std::uint32_t* parity_crc,
+        std::vector<std::byte>& f) const noexcept
+    {
+        const std::size_t table_len = lengths.empty() ? 0 : varlen_table_size(lengths.size());
+        f.resize(frame_size(parity.size() + table_len, /*parity*/true));
+        return write_parity_frame(gen, index, scheme, parity, lengths, parity_crc, std::span<std::byte>(f.data(), f.size()));
+    }
+
+    bool TxBlockAssembler::write_parity_frame(std::uint32_t gen, std::uint16_t index, std::uint8_t scheme,
+        std::span<const std::byte> parity, std::span<const std::uint16_t> lengths, const std::uint32_t* parity_crc,
+        std::span<std::byte> out) const noexcept
+    {
+        // Variable-length blocks append the N protected lengths after the parity bytes, or the one
+        // length every payload shares.
+        const std::size_t table_len = lengths.empty() ? 0 : varlen_table_size(lengths.size());
+        const std::size_t total = parity.size() + table_len;
+        if (total > 0xFFFFu) return false;
+
+        BaseHeader h{};
+        h.version = k_protocol_version;
+        h.flags1 = lengths.empty() ? std::uint8_t{ 0 }
+            : lengths.size() < cfg_.N ? static_cast<std::uint8_t>(k_flags1_varlen | k_flags1_common_len) : k_flags1_varlen;
+        h.flags2 = flags2_pack_columns(flags2_pack_parity_count_minus_one(cfg_.K), wire_columns());
+        h.fec_gen_id = gen;
+        h.seq_in_block = static_cast<std::uint16_t>(cfg_.N + index); // mark as parity
+        h.data_count = cfg_.N;
+        h.parity_count = cfg_.K;
+        h.payload_len = static_cast<std::uint16_t>(total);
+
+        // Same layout as encode_parity_frame.
+        if (out.size() < frame_size(total, /*parity*/true)) return false;
+        if (!write_header(out, h)) return false;
+        std::byte* p = out.data() + header_size();
+        p[0] = std::byte{ scheme };
+        p[1] = std::byte{ static_cast<std::uint8_t>(index) };
+        p += FrameSizes::kParitySub;
+
+        // Parity encoded in place (slab output) is already where it belongs.
+        if (!parity.empty() && parity.data() != p) std::memcpy(p, parity.data(), parity.size());
+        for (std::size_t i = 0; i < lengths.size(); ++i) {
+            ltfec::util::endian::write_u16_le(std::span<std::byte>(p + parity.size() + 2 * i, 2), lengths[i]);
+        }
+
+        // A CRC derived from the data CRCs saves a pass over the parity bytes; only the
+        // length table (if any) still has to be read.
+        std::uint32_t crc = 0;
+        if (parity_crc) {
+            crc = *parity_crc;
+            if (table_len) crc = ltfec::util::crc32c_combine(crc, ltfec::util::crc32c(p + parity.size(), table_len), table_len);
+        }
+        else {
+            crc = ltfec::util::crc32c(p, total);
+        }
+        ltfec::util::endian::write_u32_le(std::span<std::byte>(p + total, 4), crc);
+        return true;
+    }
+
+    bool TxBlockAssembler::parity_fits(std::size_t width, std::size_t table_len) const noexcept {
+        if (cfg_.K == 0) return true;
+        const std::size_t total = width + table_len;
+        if (total > 0xFFFFu) return false;
+        return !table_len || !cfg_.max_payload_len || total <= enc_.protected_len(cfg_.max_payload_len);
+    }
+
+    std::size_t TxBlockAssembler::length_table_len(std::size_t width, std::size_t min_len, std::size_t max_len) const noexcept {
+        if (min_len == width) return 0;
+        return varlen_table_size(min_len == max_len ? 1u : cfg_.N);
+    }
+
+    std::size_t TxBlockAssembler::varlen_cap() const noexcept {
+        const std::size_t limit = cfg_.max_payload_len ? cfg_.max_payload_len : 0xFFFFu;
+        if (cfg_.K == 0) return limit;
+        const std::size_t table = varlen_table_size(cfg_.N);
+        std::size_t L = limit > table ? limit - table : 0u;
+        while (L && !parity_fits(enc_.protected_len(L), table)) --L;  // GF(2^16) rounding
+        return L;
+    }
+
+    std::size_t TxBlockAssembler::max_push_len() const noexcept {
+        const std::size_t cap = varlen_cap();
+        return cap ? cap : (cfg_.max_payload_len ? cfg_.max_payload_len : 0xFFFFu);
+    }
+
+    bool TxBlockAssembler::block_width(std::span<const std::span<const std::byte>> data_payloads,
+        std::size_t& width, std::size_t& table_len) const noexcept
     {
         // Validate N
         if (data_payloads.size() != cfg_.N) return false;
         if (cfg_.N == 0) return false;
+        if (!enc_.valid()) return false;
 
-        const std::size_t L = data_payloads[0].size();
-        if (L == 0) return false;
-        if (cfg_.max_payload_len && L > cfg_.max_payload_len) return false;
-
-        // Enforce equal length
-        for (std::size_t i = 1; i < data_payloads.size(); ++i) {
-            if (data_payloads[i].size() != L) return false;
+        // Block width: the widest payload, rounded up to the scheme's symbol size.
+        std::size_t L = 0;
+        std::size_t shortest = 0xFFFFu;
+        for (const auto& p : data_payloads) {
+            if (p.empty()) return false;
+            if (cfg_.max_payload_len && p.size() > cfg_.max_payload_len) return false;
+            L = std::max(L, p.size());
+            shortest = std::min(shortest, p.size());
         }
+        width = enc_.protected_len(L);
+        table_len = length_table_len(width, shortest, L);
+        return parity_fits(width, table_len); // before a generation id is taken
+    }
+
+    bool TxBlockAssembler::assemble_block(const std::vector<std::span<const std::byte>>& data_payloads,
+        std::vector<std::vector<std::byte>>& out_frames) noexcept
+    {
+        std::size_t L = 0;
+        std::size_t table_len = 0;
+        if (!block_width(data_payloads, L, table_len)) return false;
+        const bool varlen = table_len != 0;
 
         // Prepare parity buffers
         const std::size_t K = cfg_.K;
@@ -33,62 +213,243 @@ namespace ltfec::pipeline {
         std::vector<std::byte*> parity_ptrs(cfg_.K);
         for (std::size_t j = 0; j < cfg_.K; ++j) parity_ptrs[j] = parity[j].data();
 
-        const std::uint8_t scheme = enc_.encode(std::span<const std::byte* const>(data_ptrs.data(), data_ptrs.size()),
-            L,
-            std::span<std::byte*>(parity_ptrs.data(), parity_ptrs.size()));
+        // XOR parity is folded in while the data frames are written (see emit_data_frame), and its
+        // CRC derived from theirs.
+        const bool fused = fuses_parity();
+        std::vector<std::uint32_t> crcs(fused ? cfg_.N : 0u);
+        std::uint8_t scheme = 0;
+        std::vector<std::uint16_t> lengths;
+        if (fused) {
+            scheme = enc_.pick_scheme_id();
+            if (varlen) {
+                lengths.resize(cfg_.N);
+                for (std::uint16_t i = 0; i < cfg_.N; ++i) lengths[i] = static_cast<std::uint16_t>(data_payloads[i].size());
+            }
+        }
+        else if (!varlen) {
+            scheme = enc_.encode(std::span<const std::byte* const>(data_ptrs.data(), data_ptrs.size()),
+                L,
+                std::span<std::byte*>(parity_ptrs.data(), parity_ptrs.size()));
+        }
+        else {
+            // Shorter payloads count as zero-padded to L.
+            scheme = enc_.pick_scheme_id();
+            lengths.resize(cfg_.N);
+            for (std::uint16_t i = 0; i < cfg_.N; ++i) {
+                lengths[i] = static_cast<std::uint16_t>(data_payloads[i].size());
+                enc_.accumulate(i, data_ptrs[i], data_payloads[i].size(),
+                    std::span<std::byte*>(parity_ptrs.data(), parity_ptrs.size()));
+            }
+        }
 
         // Prepare output vector
         out_frames.clear();
         out_frames.resize(cfg_.N + cfg_.K);
 
         const std::uint16_t N = cfg_.N;
-        const std::uint16_t K16 = cfg_.K;
         const std::uint32_t gen = next_gen_id_++;
 
-        // Emit DATA frames
+        // Emit DATA frames (each at its own length)
         for (std::uint16_t i = 0; i < N; ++i) {
-            BaseHeader h{};
-            h.version = k_protocol_version;
-            h.flags1 = 0;
-            h.flags2 = flags2_pack_parity_count_minus_one(K16);
-            h.fec_gen_id = gen;
-            h.seq_in_block = i;          // data index
-            h.data_count = N;
-            h.parity_count = K16;
-            h.payload_len = static_cast<std::uint16_t>(L);
-
-            auto& f = out_frames[i];
-            f.resize(encoded_size(L, /*parity*/false));
-            const bool ok = encode_data_frame(std::span<std::byte>(f.data(), f.size()),
-                h, data_payloads[i]);
-            if (!ok) return false;
+            if (!emit_data_frame(gen, i, data_payloads[i], fused ? parity[0].data() : nullptr,
+                fused ? &crcs[i] : nullptr, out_frames[i])) return false;
         }
+        const auto lens = std::span<const std::uint16_t>(lengths.data(), lengths.size());
+        const std::uint32_t fused_crc = fused ? xor_parity_crc(std::span<std::uint32_t>(crcs), lens, L) : 0u;
 
         // Emit PARITY frames (if any)
-        for (std::uint16_t j = 0; j < K16; ++j) {
-            BaseHeader h{};
-            h.version = k_protocol_version;
-            h.flags1 = 0;
-            h.flags2 = flags2_pack_parity_count_minus_one(K16);
-            h.fec_gen_id = gen;
-            h.seq_in_block = static_cast<std::uint16_t>(N + j); // mark as parity
-            h.data_count = N;
-            h.parity_count = K16;
-            h.payload_len = static_cast<std::uint16_t>(L);
-
-            ParitySubheader ps{};
-            ps.fec_scheme_id = scheme;
-            ps.fec_parity_index = static_cast<std::uint8_t>(j);
-
-            auto& f = out_frames[N + j];
-            f.resize(encoded_size(L, /*parity*/true));
-            const bool ok = encode_parity_frame(std::span<std::byte>(f.data(), f.size()),
-                h, ps,
-                std::span<const std::byte>(parity[j].data(), parity[j].size()));
-            if (!ok) return false;
+        for (std::uint16_t j = 0; j < cfg_.K; ++j) {
+            if (!emit_parity_frame(gen, j, scheme,
+                std::span<const std::byte>(parity[j].data(), parity[j].size()),
+                lens.first(table_len / 2), fused ? &fused_crc : nullptr, out_frames[N + j])) return false;
+        }
+
+        return true;
+    }
+
+    bool TxFrameSlab::reserve(std::size_t bytes) noexcept {
+        if (bytes <= cap_) return true;
+        auto* p = static_cast<std::byte*>(::operator new[](bytes, std::align_val_t{ kAlign }, std::nothrow));
+        if (!p) return false;
+        buf_.reset(p);
+        cap_ = bytes;
+        return true;
+    }
+
+    bool TxBlockAssembler::assemble_block(std::span<const std::span<const std::byte>> data_payloads,
+        TxFrameSlab& out) noexcept
+    {
+        std::size_t L = 0;
+        std::size_t table_len = 0;
+        if (!block_width(data_payloads, L, table_len)) return false;
+        const bool varlen = table_len != 0;
+
+        const std::uint16_t N = cfg_.N;
+        const std::uint16_t K = cfg_.K;
+
+        // Layout: every frame starts on a cache line.
+        auto align_up = [](std::size_t v) { return (v + TxFrameSlab::kAlign - 1) & ~(TxFrameSlab::kAlign - 1); };
+        out.frames_.resize(static_cast<std::size_t>(N) + K);
+        std::size_t off = 0;
+        for (std::size_t f = 0; f < out.frames_.size(); ++f) {
+            const std::size_t size = f < N ? frame_size(data_payloads[f].size(), /*parity*/false)
+                                           : frame_size(L + table_len, /*parity*/true);
+            out.frames_[f] = { off, size };
+            off = align_up(off + size);
+        }
+        if (!out.reserve(off)) { out.frames_.clear(); return false; }
+        std::byte* base = out.buf_.get();
+
+        // Parity is encoded straight into the parity frames' payload regions.
+        slab_data_ptrs_.resize(N);
+        slab_parity_ptrs_.resize(K);
+        for (std::uint16_t i = 0; i < N; ++i) slab_data_ptrs_[i] = data_payloads[i].data();
+        for (std::uint16_t j = 0; j < K; ++j) {
+            slab_parity_ptrs_[j] = base + out.frames_[N + j].offset + header_size() + FrameSizes::kParitySub;
+            std::memset(slab_parity_ptrs_[j], 0, L);
+        }
+        const auto parity_ptrs = std::span<std::byte*>(slab_parity_ptrs_.data(), slab_parity_ptrs_.size());
+
+        const bool fused = fuses_parity();
+        slab_crcs_.assign(fused ? N : 0u, 0u);
+        slab_lens_.resize(varlen ? N : 0u);
+        for (std::size_t i = 0; i < slab_lens_.size(); ++i) slab_lens_[i] = static_cast<std::uint16_t>(data_payloads[i].size());
+
+        // XOR parity is folded in while the data frames are written, as in the vector overload.
+        std::uint8_t scheme = enc_.pick_scheme_id();
+        if (!fused && !varlen) {
+            scheme = enc_.encode(std::span<const std::byte* const>(slab_data_ptrs_.data(), slab_data_ptrs_.size()), L, parity_ptrs);
+        }
+        else if (!fused) {
+            for (std::uint16_t i = 0; i < N; ++i) {
+                enc_.accumulate(i, slab_data_ptrs_[i], data_payloads[i].size(), parity_ptrs);
+            }
+        }
+
+        const std::uint32_t gen = next_gen_id_++;
+        auto frame = [&](std::size_t f) { return std::span<std::byte>(base + out.frames_[f].offset, out.frames_[f].size); };
+
+        for (std::uint16_t i = 0; i < N; ++i) {
+            if (!write_data_frame(gen, i, data_payloads[i], fused ? slab_parity_ptrs_[0] : nullptr,
+                fused ? &slab_crcs_[i] : nullptr, frame(i))) return false;
+        }
+        const auto lens = std::span<const std::uint16_t>(slab_lens_.data(), slab_lens_.size());
+        const std::uint32_t fused_crc = fused ? xor_parity_crc(std::span<std::uint32_t>(slab_crcs_), lens, L) : 0u;
+        for (std::uint16_t j = 0; j < K; ++j) {
+            if (!write_parity_frame(gen, j, scheme, std::span<const std::byte>(slab_parity_ptrs_[j], L),
+                lens.first(table_len / 2), fused ? &fused_crc : nullptr, frame(N + j))) return false;
+        }
+        return true;
+    }
+
+    bool TxBlockAssembler::assemble_interleaved(const std::vector<std::vector<std::span<const std::byte>>>& blocks,
+        std::vector<std::vector<std::byte>>& out_frames) noexcept
+    {
+        out_frames.clear();
+        const std::size_t D = std::max<std::size_t>(1u, cfg_.interleave_depth);
+        if (blocks.size() != D) return false;
+
+        std::vector<std::vector<std::vector<std::byte>>> per_block(D);
+        for (std::size_t b = 0; b < D; ++b) {
+            if (!assemble_block(blocks[b], per_block[b])) return false;
+        }
+
+        const std::size_t frames_per_block = static_cast<std::size_t>(cfg_.N) + cfg_.K;
+        out_frames.reserve(D * frames_per_block);
+        for (std::size_t i = 0; i < frames_per_block; ++i) {
+            for (std::size_t b = 0; b < D; ++b) out_frames.push_back(std::move(per_block[b][i]));
+        }
+        return true;
+    }
+
+    bool TxBlockAssembler::push_data(std::span<const std::byte> payload,
+        std::vector<std::vector<std::byte>>& out_frames) noexcept
+    {
+        return push_impl(payload, nullptr, out_frames);
+    }
+
+    bool TxBlockAssembler::push_data(std::span<const std::byte> payload, TxDataFrameParts& data_frame,
+        std::vector<std::vector<std::byte>>& out_parity) noexcept
+    {
+        return push_impl(payload, &data_frame, out_parity);
+    }
+
+    bool TxBlockAssembler::push_impl(std::span<const std::byte> payload, TxDataFrameParts* parts,
+        std::vector<std::vector<std::byte>>& out_frames) noexcept
+    {
+        out_frames.clear();
+        if (cfg_.N == 0) return false;
+        if (!enc_.valid()) return false;
+
+        const std::size_t L = payload.size();
+        if (L == 0) return false;
+        if (cfg_.max_payload_len && L > cfg_.max_payload_len) return false;
+        const std::size_t W = enc_.protected_len(L);
+
+        // The budget is fixed before the first frame of a block goes out: any mix of payloads up to
+        // varlen_cap() fits with the length table, so no later push can be refused for the width
+        // an earlier one took. Without room for a table, the first payload fixes every length.
+        const std::size_t cap = varlen_cap();
+        if (cap ? L > cap : pushed_ != 0 && L != push_min_len_) return false;
+        const std::size_t new_width = pushed_ == 0 ? W : std::max(push_len_, W);
+        const std::size_t new_min = pushed_ == 0 ? L : std::min(push_min_len_, L);
+        const std::size_t new_max = pushed_ == 0 ? L : std::max(push_max_len_, L);
+        if (!parity_fits(new_width, length_table_len(new_width, new_min, new_max))) return false;
+
+        if (pushed_ == 0) {
+            // First payload of a block: fixes the generation, zeroes the accumulators.
+            push_len_ = W;
+            push_gen_ = next_gen_id_++;
+            push_lens_.assign(cfg_.N, 0);
+            push_crcs_.assign(cfg_.N, 0);
+            acc_.resize(cfg_.K);
+            acc_ptrs_.resize(cfg_.K);
+            for (std::size_t j = 0; j < cfg_.K; ++j) acc_[j].assign(W, std::byte{ 0 });
         }
+        else if (W > push_len_) {
+            // Wider payload: the accumulators grow with zeros, which is what padding contributes.
+            push_len_ = W;
+            for (auto& a : acc_) a.resize(W, std::byte{ 0 });
+        }
+        for (std::size_t j = 0; j < cfg_.K; ++j) acc_ptrs_[j] = acc_[j].data();
 
+        const std::uint16_t i = pushed_;
+        const bool last = (i + 1 == cfg_.N);
+        // Parity frames follow the data frame, or start the output when the caller sends the data
+        // frame from its parts.
+        const std::size_t first_parity = parts ? 0u : 1u;
+        out_frames.resize(last ? first_parity + cfg_.K : first_parity);
+        const bool fused = fuses_parity();
+        std::byte* acc = fused ? acc_[0].data() : nullptr;
+        if (parts) parts->header_len = header_size();
+        const bool ok = parts
+            ? write_data_parts(push_gen_, i, payload, /*copy_to*/nullptr, acc, &push_crcs_[i],
+                std::span<std::byte>(parts->header), std::span<std::byte>(parts->trailer))
+            : emit_data_frame(push_gen_, i, payload, acc, &push_crcs_[i], out_frames[0]);
+        if (!ok) {
+            out_frames.clear();
+            return false;
+        }
+
+        if (!fused) enc_.accumulate(i, payload.data(), L, std::span<std::byte*>(acc_ptrs_.data(), acc_ptrs_.size()));
+        push_lens_[i] = static_cast<std::uint16_t>(L);
+        push_min_len_ = new_min;
+        push_max_len_ = new_max;
+        ++pushed_;
+        if (!last) return true;
+
+        // Block complete: parity is already accumulated, just frame it.
+        pushed_ = 0;
+        const std::uint8_t scheme = enc_.pick_scheme_id();
+        const std::size_t table_len = length_table_len(push_len_, push_min_len_, push_max_len_);
+        const auto lengths = table_len ? std::span<const std::uint16_t>(push_lens_.data(), push_lens_.size())
+                                       : std::span<const std::uint16_t>{};
+        const std::uint32_t fused_crc = fused ? xor_parity_crc(std::span<std::uint32_t>(push_crcs_), lengths, push_len_) : 0u;
+        for (std::uint16_t j = 0; j < cfg_.K; ++j) {
+            if (!emit_parity_frame(push_gen_, j, scheme, std::span<const std::byte>(acc_[j].data(), push_len_),
+                lengths.first(table_len / 2), fused ? &fused_crc : nullptr, out_frames[first_parity + j])) return false;
+        }
         return true;
     }
 
-} // namespace ltfec::pipeline
\ No newline at end of file
+} // namespace ltfec::pipeline
@@ -5,6 +5,8 @@
 #include <boost/asio.hpp>
 #include <boost/system/error_code.hpp>
 
+#include <array>
+
 namespace ltfec::transport::asio {
 
     namespace net = boost::asio;
@@ -79,6 +81,23 @@ namespace ltfec::transport::asio {
         return {};
     }
 
+    std::error_code UdpSender::send_gather(std::span<const std::byte> head,
+        std::span<const std::byte> payload,
+        std::span<const std::byte> trailer,
+        std::size_t& sent)
+    {
+        const std::array<net::const_buffer, 3> parts = {
+            net::buffer(head.data(), head.size()),
+            net::buffer(payload.data(), payload.size()),
+            net::buffer(trailer.data(), trailer.size()),
+        };
+        boost::system::error_code bec;
+        const auto n = socket_.send_to(parts, dest_ep_, 0, bec);
+        sent = static_cast<std::size_t>(n);
+        if (bec) return std::error_code(bec.value(), std::generic_category());
+        return {};
+    }
+
     std::error_code UdpReceiver::open_and_bind(const Endpoint& listen_ep, const std::string& mcast_if) {
         boost::system::error_code bec;
 
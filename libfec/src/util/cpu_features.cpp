@@ -0,0 +1,81 @@
+#include <ltfec/util/cpu_features.h>
+
+#if LTFEC_X86
+#if defined(_MSC_VER)
+#include <intrin.h>
+#include <immintrin.h>
+#else
+#include <cpuid.h>
+#endif
+#endif
+
+namespace ltfec::util {
+
+#if LTFEC_X86
+    namespace {
+
+        void cpuid(unsigned leaf, unsigned sub, unsigned regs[4]) noexcept {
+#if defined(_MSC_VER)
+            int r[4]{};
+            __cpuidex(r, static_cast<int>(leaf), static_cast<int>(sub));
+            for (int i = 0; i < 4; ++i) regs[i] = static_cast<unsigned>(r[i]);
+#else
+            __cpuid_count(leaf, sub, regs[0], regs[1], regs[2], regs[3]);
+#endif
+        }
+
+        std::uint64_t xgetbv0() noexcept {
+#if defined(_MSC_VER)
+            return _xgetbv(0);
+#else
+            unsigned lo = 0, hi = 0;
+            __asm__ volatile("xgetbv" : "=a"(lo), "=d"(hi) : "c"(0));
+            return (static_cast<std::uint64_t>(hi) << 32) | lo;
+#endif
+        }
+
+        CpuFeatures detect() noexcept {
+            CpuFeatures f{};
+            unsigned r[4]{};
+            cpuid(0, 0, r);
+            const unsigned max_leaf = r[0];
+            if (max_leaf < 1) return f;
+
+            cpuid(1, 0, r);
+            const unsigned ecx1 = r[2], edx1 = r[3];
+            f.sse2 = (edx1 >> 26) & 1u;
+            f.ssse3 = (ecx1 >> 9) & 1u;
+            f.sse42 = (ecx1 >> 20) & 1u;
+            f.pclmul = (ecx1 >> 1) & 1u;
+
+            // AVX2 needs CPU support and the OS saving XMM|YMM state (OSXSAVE + XCR0 bits 1,2).
+            const bool osxsave = (ecx1 >> 27) & 1u;
+            const bool avx = (ecx1 >> 28) & 1u;
+            if (max_leaf >= 7 && osxsave && avx && (xgetbv0() & 0x6u) == 0x6u) {
+                cpuid(7, 0, r);
+                f.avx2 = (r[1] >> 5) & 1u;
+            }
+            return f;
+        }
+
+    } // namespace
+
+    const CpuFeatures& cpu_features() noexcept {
+        static const CpuFeatures f = detect();
+        return f;
+    }
+#else
+    const CpuFeatures& cpu_features() noexcept {
+        static const CpuFeatures f{};
+        return f;
+    }
+#endif
+
+    SimdLevel best_simd_level() noexcept {
+        const auto& f = cpu_features();
+        if (f.avx2 && f.ssse3) return SimdLevel::avx2;
+        if (f.ssse3 && f.sse2) return SimdLevel::ssse3;
+        return SimdLevel::scalar;
+    }
+
+} // namespace ltfec::util
@@ -3,6 +3,7 @@
 #include <ltfec/pipeline/rx_block_table.h>
 #include <ltfec/protocol/frame_builder.h>
 #include <ltfec/sim/loss.h>
+#include "test_env.h"
 #include <vector>
 #include <string>
 #include <algorithm>
@@ -10,32 +11,13 @@
 #include <cstdint>
 #include <random>
 #include <cstring>
+#include <iostream>
+#include <iomanip>
 
 using namespace ltfec::pipeline;
 using namespace ltfec::protocol;
 using namespace ltfec::sim;
 
-static bool env_flag(const char* name) {
-#ifdef _WIN32
-    char* buf = nullptr; size_t sz = 0;
-    if (_dupenv_s(&buf, &sz, name) != 0 || !buf) return false;
-    std::string v(buf); free(buf);
-#else
-    const char* c = std::getenv(name);
-    if (!c) return false;
-    std::string v(c);
-#endif
-    // trim + lower
-    auto trim = [](std::string& s) {
-        auto issp = [](unsigned char ch) { return std::isspace(ch) != 0; };
-        while (!s.empty() && issp(s.front())) s.erase(s.begin());
-        while (!s.empty() && issp(s.back()))  s.pop_back();
-        for (auto& ch : s) ch = static_cast<char>(std::tolower(static_cast<unsigned char>(ch)));
-        };
-    trim(v);
-    return (v == "1" || v == "true" || v == "yes" || v == "on");
-}
-
 struct Arrival {
     std::uint64_t t;
     // Which block and which position in its frame vector (0..N-1 data, then N..N+K-1 parity)
@@ -203,4 +185,71 @@ BOOST_AUTO_TEST_CASE(acceptance_quick_or_full_k1) {
     }
 }
 
+// Benchmark (opt-in): LTFEC_BENCH=1 tests.exe --run_test=acceptance_suite/bench_interleave_ge_bursts
+// Effective data loss vs. mean Gilbert-Elliott burst length for interleave depths 1..8 at the same
+// N=8, K=2 overhead. Raw loss is held near 5% (bad state always drops).
+BOOST_AUTO_TEST_CASE(bench_interleave_ge_bursts) {
+    if (!env_flag("LTFEC_BENCH")) {
+        BOOST_TEST_MESSAGE("skipped (set LTFEC_BENCH=1)");
+        return;
+    }
+
+    const std::uint16_t N = 8, K = 2;
+    const std::size_t L = 64;
+    const std::uint16_t depths[] = { 1, 2, 4, 8 };
+    const double bursts[] = { 1.0, 2.0, 4.0, 8.0, 16.0 };
+    const std::uint32_t groups_target_blocks = 4000;
+
+    std::cout << "\neffective loss (raw ~5%), N=" << N << " K=" << K << "\n  burst";
+    for (auto D : depths) std::cout << "      D=" << D;
+    std::cout << "\n";
+
+    for (const double burst : bursts) {
+        std::cout << std::fixed << std::setprecision(1) << std::setw(7) << burst;
+        for (const std::uint16_t D : depths) {
+            TxBlockAssembler tx({ .N = N, .K = K, .max_payload_len = 1300, .interleave_depth = D }, 1u);
+            RxBlockTable rxt({ .reorder_ms = 50, .fps = 30, .max_payload_len = 1300, .interleave_depth = D });
+            XorShift32 rng(777u);
+            const double pb = 1.0 / burst;
+            GilbertElliottLoss ge{ .p_g_to_b = 0.05 * pb / 0.95, .p_b_to_g = pb, .p_loss_bad = 1.0 };
+
+            std::vector<std::vector<std::byte>> payload_store(static_cast<std::size_t>(D) * N);
+            std::vector<std::vector<std::span<const std::byte>>> blocks(D);
+            std::vector<std::vector<std::byte>> frames;
+            std::uint64_t total = 0, lost = 0, t = 0;
+
+            for (std::uint32_t g = 0; g < groups_target_blocks / D; ++g) {
+                for (std::uint16_t b = 0; b < D; ++b) {
+                    blocks[b].clear();
+                    for (std::uint16_t i = 0; i < N; ++i) {
+                        auto& p = payload_store[static_cast<std::size_t>(b) * N + i];
+                        p = fill_payload(static_cast<std::uint16_t>(g * N + i), L);
+                        blocks[b].emplace_back(p.data(), p.size());
+                    }
+                }
+                const std::uint32_t gen0 = tx.peek_next_gen();
+                BOOST_REQUIRE(tx.assemble_interleaved(blocks, frames));
+
+                for (const auto& f : frames) {
+                    ++t;
+                    if (ge.drop(rng)) continue;
+                    BaseHeader h{}; bool hasp = false; ParitySubheader ps{}; std::span<const std::byte> pl; std::uint32_t crc = 0;
+                    BOOST_REQUIRE(decode_frame(std::span<const std::byte>(f.data(), f.size()), h, hasp, ps, pl, crc));
+                    rxt.ingest(t, h, hasp, ps, pl);
+                }
+                for (std::uint16_t b = 0; b < D; ++b) {
+                    total += N;
+                    RxClosedBlock closed{};
+                    if (!rxt.close_if_ready(gen0 + b, t + 100000, closed)) { lost += N; continue; }
+                    for (std::uint16_t i = 0; i < N; ++i) lost += closed.data[i].size() != L;
+                }
+            }
+            std::cout << std::setw(10) << std::fixed << std::setprecision(4)
+                << static_cast<double>(lost) / static_cast<double>(total);
+        }
+        std::cout << "\n";
+    }
+    BOOST_TEST(true);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
\ No newline at end of file
@@ -41,4 +41,15 @@ BOOST_AUTO_TEST_CASE(close_at_min_of_60_or_2xspan_when_reorder_higher) {
     BOOST_TEST(bt.should_close(t0 + 60)); // min(60, 2*span) reached first
 }
 
+BOOST_AUTO_TEST_CASE(interleave_depth_stretches_close_timers) {
+    BlockPolicy pol;
+    pol.N = 8; pol.K = 1; pol.reorder_ms = 50; pol.fps = 30; pol.interleave_depth = 4;
+    BlockTracker bt(pol);
+    const std::uint64_t t0 = 3000;
+    bt.start(t0);
+    BOOST_TEST(!bt.should_close(t0 + 60));    // would close at 50 ms without interleaving
+    BOOST_TEST(!bt.should_close(t0 + 199));
+    BOOST_TEST(bt.should_close(t0 + 200));    // 4 × reorder_ms
+}
+
 BOOST_AUTO_TEST_SUITE_END()
\ No newline at end of file
@@ -7,6 +7,19 @@ using ltfec::util::crc32c;
 using ltfec::util::crc32c_init;
 using ltfec::util::crc32c_update;
 using ltfec::util::crc32c_finish;
+using ltfec::util::crc32c_update_portable;
+
+namespace {
+    // Bit-at-a-time reference, independent of any table or instruction.
+    uint32_t crc32c_bitwise(const std::byte* p, std::size_t n) {
+        uint32_t c = 0xFFFFFFFFu;
+        for (std::size_t i = 0; i < n; ++i) {
+            c ^= std::to_integer<uint32_t>(p[i]);
+            for (int k = 0; k < 8; ++k) c = (c & 1u) ? (c >> 1) ^ 0x82F63B78u : (c >> 1);
+        }
+        return ~c;
+    }
+}
 
 BOOST_AUTO_TEST_SUITE(crc32c_suite)
 
@@ -36,4 +49,54 @@ BOOST_AUTO_TEST_CASE(incremental_matches_oneshot) {
     BOOST_TEST(inc == crc32c(all));
 }
 
+BOOST_AUTO_TEST_CASE(dispatched_and_portable_match_reference) {
+    // Covers the unaligned head, both stripe sizes of the interleaved path and every tail length.
+    std::vector<std::byte> buf(9000 + 8);
+    uint32_t x = 0x12345678u;
+    for (auto& b : buf) { x ^= x << 13; x ^= x >> 17; x ^= x << 5; b = std::byte{ static_cast<unsigned char>(x) }; }
+
+    const std::size_t lens[] = { 0, 1, 7, 8, 9, 63, 383, 384, 385, 1300, 1500, 3071, 3072, 3073, 4000, 9000 };
+    for (std::size_t off = 0; off < 8; ++off) {
+        for (auto n : lens) {
+            const std::span<const std::byte> s(buf.data() + off, n);
+            const uint32_t want = crc32c_bitwise(s.data(), n);
+            BOOST_TEST(crc32c(s) == want);
+            BOOST_TEST(crc32c_finish(crc32c_update_portable(crc32c_init(), s)) == want);
+        }
+    }
+    BOOST_TEST_MESSAGE("crc32c hardware path: " << ltfec::util::crc32c_hardware());
+}
+
+BOOST_AUTO_TEST_CASE(combine_shift_xor_of_match_direct) {
+    std::vector<std::byte> buf(3000);
+    uint32_t x = 0x9E3779B9u;
+    for (auto& b : buf) { x ^= x << 13; x ^= x >> 17; x ^= x << 5; b = std::byte{ static_cast<unsigned char>(x) }; }
+    const auto sp = [&](std::size_t off, std::size_t n) { return std::span<const std::byte>(buf.data() + off, n); };
+
+    // crc(A || B) for split points including empty halves.
+    const std::size_t splits[] = { 0, 1, 5, 64, 1299, 1300 };
+    for (auto a : splits) {
+        const std::size_t b = 1300 - a;
+        BOOST_TEST(ltfec::util::crc32c_combine(crc32c(sp(0, a)), crc32c(sp(a, b)), b) == crc32c(sp(0, 1300)));
+        BOOST_TEST(ltfec::util::crc32c_combine(crc32c(sp(0, a)), crc32c(sp(a, b)), b)
+            == (ltfec::util::crc32c_shift(crc32c(sp(0, a)), b) ^ crc32c(sp(a, b))));
+    }
+
+    const std::vector<std::byte> zeros(777);
+    BOOST_TEST(ltfec::util::crc32c_zeros(777) == crc32c(zeros.data(), zeros.size()));
+    BOOST_TEST(ltfec::util::crc32c_zeros(0) == 0u);
+
+    // XOR of m equal-length buffers, for odd and even m.
+    for (std::size_t m = 1; m <= 4; ++m) {
+        const std::size_t L = 700;
+        std::vector<std::byte> acc(L);
+        std::vector<uint32_t> crcs;
+        for (std::size_t i = 0; i < m; ++i) {
+            for (std::size_t k = 0; k < L; ++k) acc[k] ^= buf[i * L + k];
+            crcs.push_back(crc32c(sp(i * L, L)));
+        }
+        BOOST_TEST(ltfec::util::crc32c_xor_of(crcs, L) == crc32c(acc.data(), L));
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
\ No newline at end of file
@@ -93,4 +93,88 @@ BOOST_AUTO_TEST_CASE(encode_decode_parity_frame) {
     BOOST_TEST(verify_payload_crc(pay_view, crc));
 }
 
+BOOST_AUTO_TEST_CASE(v2_header_round_trip_and_implicit_length) {
+    const auto payload = to_bytes("TELEMETRY-64");
+
+    BaseHeader h{};
+    h.version = k_protocol_version_v2;
+    h.flags1 = 0;
+    h.flags2 = flags2_pack_parity_count_minus_one(4);
+    h.fec_gen_id = 0x00125678u;  // only the low 16 bits go on the wire
+    h.seq_in_block = 1000;
+    h.data_count = 1024;
+    h.parity_count = 4;
+    h.payload_len = static_cast<std::uint16_t>(payload.size());
+
+    // Data frame: 8 + payload + 4, length implied by the buffer size
+    std::vector<std::byte> buf(encoded_size_v2(payload.size(), /*with_parity_subheader=*/false));
+    BOOST_TEST(buf.size() == encoded_size(payload.size(), false) - 8u);
+    BOOST_TEST(encode_data_frame_v2(std::span<std::byte>(buf), h, std::span<const std::byte>(payload)));
+    BOOST_TEST(u8(buf[0]) == 2u);
+
+    BaseHeader r{};
+    bool has_parity = true;
+    ParitySubheader ps{};
+    std::span<const std::byte> pay_view;
+    std::uint32_t crc = 0;
+    BOOST_TEST(decode_frame(std::span<const std::byte>(buf), r, has_parity, ps, pay_view, crc));
+    BOOST_TEST(!has_parity);
+    BOOST_TEST(r.version == k_protocol_version_v2);
+    BOOST_TEST(r.fec_gen_id == 0x5678u);
+    BOOST_TEST(r.seq_in_block == 1000u);
+    BOOST_TEST(r.data_count == 1024u);
+    BOOST_TEST(r.parity_count == 4u);
+    BOOST_TEST(r.flags2 == h.flags2);
+    BOOST_TEST(r.payload_len == payload.size());
+    BOOST_TEST(verify_payload_crc(pay_view, crc));
+
+    // A truncated datagram is a shorter payload with a garbage trailer, not a parse error
+    BOOST_TEST(decode_frame(std::span<const std::byte>(buf).first(buf.size() - 1), r, has_parity, ps, pay_view, crc));
+    BOOST_TEST(!verify_payload_crc(pay_view, crc));
+    BOOST_TEST(!decode_frame(std::span<const std::byte>(buf).first(11), r, has_parity, ps, pay_view, crc));
+
+    // Parity frame with explicit length: trailing bytes after the frame are ignored
+    h.seq_in_block = 1024 + 3;
+    ParitySubheader pps{};
+    pps.fec_scheme_id = static_cast<std::uint8_t>(ltfec::protocol::fec_scheme_id::cauchy_gf256);
+    pps.fec_parity_index = 3;
+    std::vector<std::byte> pbuf(encoded_size_v2(payload.size(), true, /*explicit_len=*/true) + 5);
+    BOOST_TEST(encode_parity_frame_v2(std::span<std::byte>(pbuf), h, pps, std::span<const std::byte>(payload), true));
+    BOOST_TEST(decode_frame(std::span<const std::byte>(pbuf), r, has_parity, ps, pay_view, crc));
+    BOOST_TEST(has_parity);
+    BOOST_TEST(ps.fec_scheme_id == pps.fec_scheme_id);
+    BOOST_TEST(ps.fec_parity_index == 3u);
+    BOOST_TEST(r.payload_len == payload.size());
+    BOOST_TEST(verify_payload_crc(pay_view, crc));
+}
+
+BOOST_AUTO_TEST_CASE(v2_rejects_what_it_cannot_describe) {
+    const auto payload = to_bytes("X");
+    BaseHeader h{};
+    h.flags2 = flags2_pack_parity_count_minus_one(1);
+    h.seq_in_block = 0;
+    h.data_count = 8;
+    h.parity_count = 1;
+    h.payload_len = 1;
+    BOOST_TEST(fits_header_v2(h));
+
+    std::vector<std::byte> buf(64);
+    auto out = std::span<std::byte>(buf);
+    auto pay = std::span<const std::byte>(payload);
+    BaseHeader big = h; big.data_count = 1025;
+    BOOST_TEST(!encode_data_frame_v2(out, big, pay));
+    BaseHeader wide = h; wide.parity_count = 256;
+    BOOST_TEST(!encode_data_frame_v2(out, wide, pay));
+    BaseHeader cols = h; cols.flags2 = flags2_pack_columns(h.flags2, 4);
+    BOOST_TEST(!encode_data_frame_v2(out, cols, pay));
+    BaseHeader sliding = h; sliding.flags1 = k_flags1_sliding_window;
+    BOOST_TEST(!encode_data_frame_v2(out, sliding, pay));
+
+    // Reserved bits set: not a frame we understand
+    BOOST_TEST(encode_data_frame_v2(out, h, pay));
+    buf[7] = std::byte{ static_cast<unsigned char>(u8(buf[7]) | 0x80u) };
+    BaseHeader r{}; bool hp = false; ParitySubheader ps{}; std::span<const std::byte> pv; std::uint32_t crc = 0;
+    BOOST_TEST(!decode_frame(std::span<const std::byte>(buf.data(), encoded_size_v2(1, false)), r, hp, ps, pv, crc));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
\ No newline at end of file
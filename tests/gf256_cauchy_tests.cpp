@@ -0,0 +1,158 @@
+#include <boost/test/unit_test.hpp>  // not the included runner
+#include <ltfec/fec_core/gf256_cauchy.h>
+#include <ltfec/pipeline/fec_encoder.h>
+#include <ltfec/pipeline/tx_block_assembler.h>
+#include <ltfec/pipeline/rx_block_table.h>
+#include <ltfec/protocol/frame_builder.h>
+#include <ltfec/protocol/ids.h>
+#include <ltfec/sim/rng.h>
+#include "test_frames.h"
+#include <algorithm>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+using namespace ltfec::fec_core;
+using namespace ltfec::pipeline;
+using namespace ltfec::protocol;
+
+BOOST_AUTO_TEST_SUITE(gf256_cauchy_suite)
+
+BOOST_AUTO_TEST_CASE(supports_bounds) {
+    BOOST_TEST(cauchy_supports(64, 8));
+    BOOST_TEST(cauchy_supports(224, 32));
+    BOOST_TEST(!cauchy_supports(225, 32));
+    BOOST_TEST(!cauchy_supports(8, 33));
+    BOOST_TEST(!cauchy_supports(8, 0));
+    BOOST_TEST(!cauchy_supports(0, 8));
+}
+
+BOOST_AUTO_TEST_CASE(recover_random_patterns_n64_k8) {
+    // MDS: any m <= K data erasures are recoverable from any m surviving parity rows.
+    const std::size_t N = 64, K = 8, L = 300;
+    auto data = random_frames(N, L, 77u);
+    std::vector<std::vector<std::byte>> parity(K, std::vector<std::byte>(L));
+    std::vector<const std::byte*> dptr(N);
+    std::vector<std::byte*> pptr(K);
+    for (std::size_t i = 0; i < N; ++i) dptr[i] = data[i].data();
+    for (std::size_t j = 0; j < K; ++j) pptr[j] = parity[j].data();
+    gf256_cauchy_encode(std::span<const std::byte* const>(dptr), L, std::span<std::byte*>(pptr));
+
+    ltfec::sim::XorShift32 rng(5u);
+    int failures = 0;
+    for (int trial = 0; trial < 200; ++trial) {
+        const std::size_t m = 1 + rng.next_u32() % K;
+
+        // Choose m distinct missing data indices and keep a random m-subset of parity rows.
+        std::vector<std::uint16_t> order(N);
+        for (std::size_t i = 0; i < N; ++i) order[i] = static_cast<std::uint16_t>(i);
+        for (std::size_t i = N - 1; i > 0; --i) std::swap(order[i], order[rng.next_u32() % (i + 1)]);
+        std::vector<std::uint16_t> miss(order.begin(), order.begin() + static_cast<std::ptrdiff_t>(m));
+        std::sort(miss.begin(), miss.end());
+
+        std::vector<std::size_t> prow(K);
+        for (std::size_t j = 0; j < K; ++j) prow[j] = j;
+        for (std::size_t j = K - 1; j > 0; --j) std::swap(prow[j], prow[rng.next_u32() % (j + 1)]);
+
+        std::vector<const std::byte*> d(dptr.begin(), dptr.end());
+        for (auto i : miss) d[i] = nullptr;
+        std::vector<const std::byte*> p(K, nullptr);
+        for (std::size_t r = 0; r < m; ++r) p[prow[r]] = parity[prow[r]].data();
+
+        std::vector<std::vector<std::byte>> rec(m, std::vector<std::byte>(L));
+        std::vector<std::byte*> out(m);
+        for (std::size_t r = 0; r < m; ++r) out[r] = rec[r].data();
+
+        if (!gf256_cauchy_recover(std::span<const std::byte* const>(d), std::span<const std::byte* const>(p), L,
+            std::span<const std::uint16_t>(miss), std::span<std::byte*>(out))) {
+            ++failures;
+            continue;
+        }
+        for (std::size_t r = 0; r < m; ++r) {
+            if (rec[r] != data[miss[r]]) ++failures;
+        }
+    }
+    BOOST_TEST(failures == 0);
+}
+
+BOOST_AUTO_TEST_CASE(insufficient_parity_fails) {
+    const std::size_t N = 10, K = 6, L = 16;
+    auto data = random_frames(N, L, 3u);
+    std::vector<std::vector<std::byte>> parity(K, std::vector<std::byte>(L));
+    std::vector<const std::byte*> d(N);
+    std::vector<std::byte*> pptr(K);
+    for (std::size_t i = 0; i < N; ++i) d[i] = data[i].data();
+    for (std::size_t j = 0; j < K; ++j) pptr[j] = parity[j].data();
+    gf256_cauchy_encode(std::span<const std::byte* const>(d), L, std::span<std::byte*>(pptr));
+
+    d[2] = d[5] = d[7] = nullptr;
+    std::vector<const std::byte*> p = { parity[0].data(), nullptr, nullptr, nullptr, parity[4].data(), nullptr };
+    const std::vector<std::uint16_t> miss = { 2, 5, 7 };
+    std::vector<std::byte> r0(L), r1(L), r2(L);
+    std::vector<std::byte*> out = { r0.data(), r1.data(), r2.data() };
+    BOOST_TEST(!gf256_cauchy_recover(std::span<const std::byte* const>(d), std::span<const std::byte* const>(p), L,
+        std::span<const std::uint16_t>(miss), std::span<std::byte*>(out)));
+}
+
+BOOST_AUTO_TEST_CASE(encoder_picks_cauchy_above_k4) {
+    const FecEncoder e8({ .N = 64, .K = 8, .fec_scheme_id = 0 });
+    BOOST_TEST(e8.pick_scheme_id() == static_cast<std::uint8_t>(fec_scheme_id::cauchy_gf256));
+    BOOST_TEST(e8.valid());
+
+    const FecEncoder e4({ .N = 8, .K = 4, .fec_scheme_id = 0 });
+    BOOST_TEST(e4.pick_scheme_id() == static_cast<std::uint8_t>(fec_scheme_id::gf256_k4));
+
+    const FecEncoder big({ .N = 250, .K = 8, .fec_scheme_id = 0 }); // N+K > 256: moves to GF(2^16)
+    BOOST_TEST(big.pick_scheme_id() == static_cast<std::uint8_t>(fec_scheme_id::cauchy_gf65536));
+    BOOST_TEST(big.valid());
+
+    const FecEncoder too_many({ .N = 250, .K = 257, .fec_scheme_id = 0 }); // K > 256
+    BOOST_TEST(!too_many.valid());
+
+    const FecEncoder forced({ .N = 8, .K = 2, .fec_scheme_id = static_cast<std::uint8_t>(fec_scheme_id::cauchy_gf256) });
+    BOOST_TEST(forced.valid());
+}
+
+BOOST_AUTO_TEST_CASE(rx_recovers_n64_k8_block) {
+    const std::uint16_t N = 64, K = 8;
+    const std::size_t L = 1200;
+    TxBlockAssembler tx({ .N = N, .K = K, .max_payload_len = 1300 }, /*gen_seed*/ 900u);
+
+    const auto payloads = random_frames(N, L, 11u);
+    std::vector<std::span<const std::byte>> data;
+    for (const auto& p : payloads) data.emplace_back(p.data(), p.size());
+
+    std::vector<std::vector<std::byte>> frames;
+    BOOST_TEST(tx.assemble_block(data, frames));
+    BOOST_TEST(frames.size() == static_cast<std::size_t>(N + K));
+    const std::uint32_t gen = tx.peek_next_gen() - 1;
+
+    // Drop 8 data frames spread over the block; deliver everything else.
+    const std::vector<std::uint16_t> dropped = { 0, 9, 17, 31, 32, 40, 55, 63 };
+    RxBlockTable rxt({ .reorder_ms = 50, .fps = 30, .max_payload_len = 1300 });
+    const std::uint64_t t0 = 1000;
+    for (std::size_t i = 0; i < frames.size(); ++i) {
+        if (std::find(dropped.begin(), dropped.end(), static_cast<std::uint16_t>(i)) != dropped.end()) continue;
+        BaseHeader h{}; bool hasp = false; ParitySubheader ps{}; std::span<const std::byte> pl; std::uint32_t crc = 0;
+        BOOST_TEST(decode_frame(std::span<const std::byte>(frames[i].data(), frames[i].size()), h, hasp, ps, pl, crc));
+        if (hasp) BOOST_TEST(ps.fec_scheme_id == static_cast<std::uint8_t>(fec_scheme_id::cauchy_gf256));
+        BOOST_TEST(rxt.ingest(t0, h, hasp, ps, pl));
+    }
+
+    RxClosedBlock closed{};
+    BOOST_TEST(rxt.close_if_ready(gen, t0 + 60, closed));
+    for (auto i : dropped) {
+        BOOST_TEST(closed.was_recovered[i]);
+        BOOST_TEST((closed.data[i] == payloads[i]));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(assemble_rejects_unsupported_k) {
+    TxBlockAssembler tx({ .N = 250, .K = 257, .max_payload_len = 1300 }, 1u);
+    std::vector<std::byte> p(10);
+    std::vector<std::span<const std::byte>> data(250, std::span<const std::byte>(p.data(), p.size()));
+    std::vector<std::vector<std::byte>> frames;
+    BOOST_TEST(!tx.assemble_block(data, frames));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
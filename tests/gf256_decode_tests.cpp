@@ -0,0 +1,121 @@
+#include <boost/test/unit_test.hpp>  // not the included runner
+#include <ltfec/fec_core/gf256.h>
+#include <ltfec/fec_core/gf256_decode.h>
+#include <ltfec/fec_core/gf256_region.h>
+#include <ltfec/sim/rng.h>
+#include <array>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+using namespace ltfec::fec_core;
+
+namespace {
+    std::uint8_t ref_mul(std::uint8_t a, std::uint8_t b) {
+        std::uint8_t p = 0;
+        for (int i = 0; i < 8; ++i) {
+            if (b & 1u) p ^= a;
+            const bool carry = (a & 0x80u) != 0;
+            a = static_cast<std::uint8_t>(a << 1);
+            if (carry) a ^= 0x1Du;
+            b >>= 1;
+        }
+        return p;
+    }
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(gf256_decode_suite)
+
+BOOST_AUTO_TEST_CASE(invert_matrix_roundtrip) {
+    ltfec::sim::XorShift32 rng(1234u);
+    for (int m = 1; m <= 8; ++m) {
+        // Random matrices are invertible with high probability; skip the singular ones.
+        for (int attempt = 0; attempt < 10; ++attempt) {
+            std::vector<std::uint8_t> a(static_cast<std::size_t>(m) * m);
+            for (auto& v : a) v = static_cast<std::uint8_t>(rng.next_u32() & 0xFFu);
+            auto inv = a;
+            if (!gf256_invert_matrix(std::span<std::uint8_t>(inv), m)) continue;
+
+            for (int r = 0; r < m; ++r) {
+                for (int c = 0; c < m; ++c) {
+                    std::uint8_t acc = 0;
+                    for (int k = 0; k < m; ++k) acc ^= ref_mul(a[r * m + k], inv[k * m + c]);
+                    BOOST_TEST(acc == (r == c ? 1u : 0u));
+                }
+            }
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(invert_matrix_detects_singular) {
+    std::array<std::uint8_t, 4> a = { 3, 5, 3, 5 }; // duplicate rows
+    BOOST_TEST(!gf256_invert_matrix(std::span<std::uint8_t>(a), 2));
+}
+
+BOOST_AUTO_TEST_CASE(recover_every_double_erasure_mtu_payload) {
+    const std::size_t N = 8, K = 4, L = 1300;
+    ltfec::sim::XorShift32 rng(42u);
+    std::vector<std::vector<std::byte>> data(N, std::vector<std::byte>(L));
+    for (auto& f : data) for (auto& b : f) b = std::byte{ static_cast<unsigned char>(rng.next_u32() & 0xFFu) };
+
+    std::vector<const std::byte*> dptr(N);
+    for (std::size_t d = 0; d < N; ++d) dptr[d] = data[d].data();
+    std::vector<std::vector<std::byte>> parity(K, std::vector<std::byte>(L));
+    std::vector<std::byte*> pptr(K);
+    for (std::size_t j = 0; j < K; ++j) pptr[j] = parity[j].data();
+    gf256_encode(std::span<const std::byte* const>(dptr), L, std::span<std::byte*>(pptr));
+
+    for (std::uint16_t a = 0; a < N; ++a) {
+        for (std::uint16_t b = a + 1; b < N; ++b) {
+            auto present = dptr;
+            present[a] = present[b] = nullptr;
+            // Use parity rows 1 and 3 only.
+            std::vector<const std::byte*> prow = { nullptr, parity[1].data(), nullptr, parity[3].data() };
+
+            const std::uint16_t miss[2] = { a, b };
+            std::vector<std::byte> r0(L), r1(L);
+            std::byte* outs[2] = { r0.data(), r1.data() };
+            BOOST_TEST(gf256_recover_erasures_vandermonde(std::span<const std::byte* const>(present),
+                std::span<const std::byte* const>(prow), L,
+                std::span<const std::uint16_t>(miss, 2), std::span<std::byte*>(outs, 2)));
+            BOOST_TEST(r0 == data[a]);
+            BOOST_TEST(r1 == data[b]);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(recover_from_precomputed_syndromes) {
+    const std::size_t N = 6, K = 3, L = 64;
+    ltfec::sim::XorShift32 rng(99u);
+    std::vector<std::vector<std::byte>> data(N, std::vector<std::byte>(L));
+    for (auto& f : data) for (auto& b : f) b = std::byte{ static_cast<unsigned char>(rng.next_u32() & 0xFFu) };
+    std::vector<const std::byte*> dptr(N);
+    for (std::size_t d = 0; d < N; ++d) dptr[d] = data[d].data();
+    std::vector<std::vector<std::byte>> parity(K, std::vector<std::byte>(L));
+    std::vector<std::byte*> pptr(K);
+    for (std::size_t j = 0; j < K; ++j) pptr[j] = parity[j].data();
+    gf256_encode(std::span<const std::byte* const>(dptr), L, std::span<std::byte*>(pptr));
+
+    // Frames 1 and 4 lost; fold the survivors into rows 0 and 2 the way an incremental receiver would.
+    std::vector<std::vector<std::byte>> syn = { parity[0], parity[1], parity[2] };
+    for (std::size_t d = 0; d < N; ++d) {
+        if (d == 1 || d == 4) continue;
+        for (std::size_t j = 0; j < K; ++j) gf256_mul_add_region(syn[j].data(), data[d].data(), vandermonde_coef(j, d), L);
+    }
+    std::vector<const std::byte*> rows = { syn[0].data(), nullptr, syn[2].data() };
+
+    const std::uint16_t miss[2] = { 1, 4 };
+    std::vector<std::byte> r0(L), r1(L);
+    std::byte* outs[2] = { r0.data(), r1.data() };
+    BOOST_TEST(gf256_recover_from_syndromes(&vandermonde_coef, std::span<const std::byte* const>(rows), L,
+        std::span<const std::uint16_t>(miss, 2), std::span<std::byte*>(outs, 2)));
+    BOOST_TEST(r0 == data[1]);
+    BOOST_TEST(r1 == data[4]);
+
+    // Too few rows
+    rows[2] = nullptr;
+    BOOST_TEST(!gf256_recover_from_syndromes(&vandermonde_coef, std::span<const std::byte* const>(rows), L,
+        std::span<const std::uint16_t>(miss, 2), std::span<std::byte*>(outs, 2)));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
\ No newline at end of file
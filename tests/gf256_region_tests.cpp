@@ -0,0 +1,90 @@
+#include <boost/test/unit_test.hpp>  // not the included runner
+#include <ltfec/fec_core/gf256_region.h>
+#include <ltfec/sim/rng.h>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+using namespace ltfec::fec_core;
+using ltfec::util::SimdLevel;
+
+namespace {
+    // Bitwise reference multiply (poly 0x11D), independent of any table.
+    std::uint8_t ref_mul(std::uint8_t a, std::uint8_t b) {
+        std::uint8_t p = 0;
+        for (int i = 0; i < 8; ++i) {
+            if (b & 1u) p ^= a;
+            const bool carry = (a & 0x80u) != 0;
+            a = static_cast<std::uint8_t>(a << 1);
+            if (carry) a ^= 0x1Du;
+            b >>= 1;
+        }
+        return p;
+    }
+
+    std::vector<std::byte> random_bytes(std::size_t n, ltfec::sim::XorShift32& rng) {
+        std::vector<std::byte> v(n);
+        for (auto& b : v) b = std::byte{ static_cast<unsigned char>(rng.next_u32() & 0xFFu) };
+        return v;
+    }
+
+    unsigned u8(std::byte b) { return static_cast<unsigned>(std::to_integer<unsigned char>(b)); }
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(gf256_region_suite)
+
+BOOST_AUTO_TEST_CASE(mul_add_matches_reference_all_levels) {
+    ltfec::sim::XorShift32 rng(0xC0FFEEu);
+    // Lengths straddle the 16/32/64-byte kernel boundaries plus a typical MTU payload.
+    const std::size_t lens[] = { 0, 1, 15, 16, 17, 31, 32, 33, 63, 64, 65, 100, 1300 };
+    const std::uint8_t coefs[] = { 0, 1, 2, 3, 0x1D, 0x80, 0x8E, 0xFF };
+    const SimdLevel levels[] = { SimdLevel::scalar, SimdLevel::ssse3, SimdLevel::avx2 };
+
+    for (auto L : lens) {
+        const auto src = random_bytes(L, rng);
+        const auto dst0 = random_bytes(L, rng);
+        for (auto c : coefs) {
+            std::vector<std::byte> want = dst0;
+            for (std::size_t i = 0; i < L; ++i)
+                want[i] ^= std::byte{ ref_mul(c, static_cast<std::uint8_t>(u8(src[i]))) };
+
+            for (auto lv : levels) {
+                std::vector<std::byte> got = dst0;
+                gf256_mul_add_region(got.data(), src.data(), c, L, lv);
+                BOOST_TEST(got == want);
+            }
+            std::vector<std::byte> got = dst0;
+            gf256_mul_add_region(got.data(), src.data(), c, L);
+            BOOST_TEST(got == want);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(mul_add_every_coefficient) {
+    ltfec::sim::XorShift32 rng(7u);
+    const std::size_t L = 77;
+    const auto src = random_bytes(L, rng);
+    for (unsigned c = 0; c < 256; ++c) {
+        std::vector<std::byte> got(L);
+        gf256_mul_add_region(got.data(), src.data(), static_cast<std::uint8_t>(c), L);
+        for (std::size_t i = 0; i < L; ++i) {
+            BOOST_TEST(u8(got[i]) == ref_mul(static_cast<std::uint8_t>(c), static_cast<std::uint8_t>(u8(src[i]))));
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(mul_region_overwrites_and_supports_in_place) {
+    ltfec::sim::XorShift32 rng(99u);
+    const std::size_t L = 600;
+    const auto src = random_bytes(L, rng);
+
+    std::vector<std::byte> out = random_bytes(L, rng);
+    gf256_mul_region(out.data(), src.data(), 0x53, L);
+    for (std::size_t i = 0; i < L; ++i) BOOST_TEST(u8(out[i]) == ref_mul(0x53, static_cast<std::uint8_t>(u8(src[i]))));
+
+    std::vector<std::byte> inplace = src;
+    gf256_mul_region(inplace.data(), inplace.data(), 0x53, L);
+    BOOST_TEST(inplace == out);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
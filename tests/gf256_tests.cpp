@@ -1,5 +1,6 @@
 ﻿#include <boost/test/unit_test.hpp>  // not the included runner
 #include <ltfec/fec_core/gf256.h>
+#include <ltfec/fec_core/gf256_field.h>
 #include <vector>
 #include <string>
 #include <cstddef>
@@ -90,4 +91,22 @@ BOOST_AUTO_TEST_CASE(encode_K3_basic_shapes) {
     }
 }
 
+BOOST_AUTO_TEST_CASE(field_tables_match_reference) {
+    namespace gf = ltfec::fec_core::gf256;
+    int bad = 0;
+    for (unsigned a = 0; a < 256; ++a) {
+        const auto c = static_cast<std::uint8_t>(a);
+        for (unsigned b = 0; b < 256; ++b) {
+            if (gf::mul(c, static_cast<std::uint8_t>(b)) != T().mul(c, static_cast<std::uint8_t>(b))) ++bad;
+        }
+        if (c != 0 && gf::mul(c, gf::inv(c)) != 1u) ++bad;
+        for (unsigned i = 0; i < 16; ++i) {
+            if (gf::kNibble[c][i] != T().mul(c, static_cast<std::uint8_t>(i))) ++bad;
+            if (gf::kNibble[c][16 + i] != T().mul(c, static_cast<std::uint8_t>(i << 4))) ++bad;
+        }
+    }
+    for (unsigned e = 0; e < 600; ++e) if (gf::pow_alpha(e) != T().pow_a(e)) ++bad;
+    BOOST_TEST(bad == 0);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
\ No newline at end of file
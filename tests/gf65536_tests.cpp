@@ -0,0 +1,163 @@
+#include <boost/test/unit_test.hpp>  // not the included runner
+#include <ltfec/fec_core/gf65536.h>
+#include <ltfec/pipeline/fec_encoder.h>
+#include <ltfec/pipeline/tx_block_assembler.h>
+#include <ltfec/pipeline/rx_block_table.h>
+#include <ltfec/protocol/frame_builder.h>
+#include <ltfec/protocol/ids.h>
+#include <ltfec/sim/rng.h>
+#include "test_frames.h"
+#include <algorithm>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+using namespace ltfec::fec_core;
+using namespace ltfec::pipeline;
+using namespace ltfec::protocol;
+using ltfec::util::SimdLevel;
+
+BOOST_AUTO_TEST_SUITE(gf65536_suite)
+
+BOOST_AUTO_TEST_CASE(field_identities) {
+    BOOST_TEST(gf65536::pow_alpha(0) == 1u);
+    BOOST_TEST(gf65536::pow_alpha(65535) == 1u);
+    BOOST_TEST(gf65536::pow_alpha(16) == static_cast<std::uint16_t>(gf65536::kPoly & 0xFFFFu)); // α^16 reduces by the polynomial
+
+    ltfec::sim::XorShift32 rng(3u);
+    for (int i = 0; i < 2000; ++i) {
+        const auto a = static_cast<std::uint16_t>(rng.next_u32());
+        const auto b = static_cast<std::uint16_t>(rng.next_u32());
+        const auto c = static_cast<std::uint16_t>(rng.next_u32());
+        BOOST_TEST(gf65536::mul(a, b) == gf65536::mul(b, a));
+        BOOST_TEST(gf65536::mul(a, gf65536::add(b, c)) == gf65536::add(gf65536::mul(a, b), gf65536::mul(a, c)));
+        if (a) BOOST_TEST(gf65536::mul(a, gf65536::inv(a)) == 1u);
+    }
+    BOOST_TEST(gf65536::mul(0, 1234) == 0u);
+}
+
+BOOST_AUTO_TEST_CASE(region_kernels_agree_with_field) {
+    const auto src = random_frames(1, 1302, 9u)[0];
+    for (const std::uint16_t c : { std::uint16_t{ 0 }, std::uint16_t{ 1 }, std::uint16_t{ 2 }, std::uint16_t{ 0x1234 }, std::uint16_t{ 0xFFFF } }) {
+        for (const std::size_t len : { std::size_t{ 2 }, std::size_t{ 30 }, std::size_t{ 64 }, std::size_t{ 98 }, std::size_t{ 1302 } }) {
+            std::vector<std::byte> expect(len, std::byte{ 0x5A });
+            for (std::size_t i = 0; i < len; i += 2) {
+                const auto s = static_cast<std::uint16_t>(std::to_integer<unsigned>(src[i]) | (std::to_integer<unsigned>(src[i + 1]) << 8));
+                const std::uint16_t p = gf65536::mul(c, s);
+                expect[i] ^= std::byte{ static_cast<unsigned char>(p & 0xFFu) };
+                expect[i + 1] ^= std::byte{ static_cast<unsigned char>(p >> 8) };
+            }
+            for (const auto level : { SimdLevel::scalar, SimdLevel::ssse3, SimdLevel::avx2 }) {
+                std::vector<std::byte> dst(len, std::byte{ 0x5A });
+                gf65536_mul_add_region(dst.data(), src.data(), c, len, level);
+                BOOST_TEST((dst == expect));
+            }
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(recover_random_patterns_n1000_k32) {
+    const std::size_t N = 1000, K = 32, L = 128;
+    auto data = random_frames(N, L, 21u);
+    std::vector<std::vector<std::byte>> parity(K, std::vector<std::byte>(L));
+    std::vector<const std::byte*> dptr(N);
+    std::vector<std::byte*> pptr(K);
+    for (std::size_t i = 0; i < N; ++i) dptr[i] = data[i].data();
+    for (std::size_t j = 0; j < K; ++j) pptr[j] = parity[j].data();
+    gf65536_cauchy_encode(std::span<const std::byte* const>(dptr), L, std::span<std::byte*>(pptr));
+
+    ltfec::sim::XorShift32 rng(8u);
+    for (int trial = 0; trial < 10; ++trial) {
+        const std::size_t m = 1 + rng.next_u32() % K;
+        std::vector<std::uint16_t> order(N);
+        for (std::size_t i = 0; i < N; ++i) order[i] = static_cast<std::uint16_t>(i);
+        for (std::size_t i = N - 1; i > 0; --i) std::swap(order[i], order[rng.next_u32() % (i + 1)]);
+        std::vector<std::uint16_t> miss(order.begin(), order.begin() + static_cast<std::ptrdiff_t>(m));
+        std::sort(miss.begin(), miss.end());
+
+        // Keep the last m parity rows only.
+        std::vector<const std::byte*> d(dptr.begin(), dptr.end());
+        for (auto i : miss) d[i] = nullptr;
+        std::vector<const std::byte*> p(K, nullptr);
+        for (std::size_t j = K - m; j < K; ++j) p[j] = parity[j].data();
+
+        std::vector<std::vector<std::byte>> rec(m, std::vector<std::byte>(L));
+        std::vector<std::byte*> out(m);
+        for (std::size_t k = 0; k < m; ++k) out[k] = rec[k].data();
+        BOOST_TEST(gf65536_cauchy_recover(std::span<const std::byte* const>(d), std::span<const std::byte* const>(p), L,
+            std::span<const std::uint16_t>(miss), std::span<std::byte*>(out)));
+        for (std::size_t k = 0; k < m; ++k) BOOST_TEST((rec[k] == data[miss[k]]));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(rx_recovers_n2000_k40_block) {
+    const std::uint16_t N = 2000, K = 40;
+    const std::size_t L = 200;
+    TxBlockAssembler tx({ .N = N, .K = K, .max_payload_len = 1300 }, /*gen_seed*/ 70u);
+
+    const auto payloads = random_frames(N, L, 12u);
+    std::vector<std::span<const std::byte>> data;
+    for (const auto& p : payloads) data.emplace_back(p.data(), p.size());
+
+    std::vector<std::vector<std::byte>> frames;
+    BOOST_TEST(tx.assemble_block(data, frames));
+    BOOST_TEST(frames.size() == static_cast<std::size_t>(N + K));
+    const std::uint32_t gen = tx.peek_next_gen() - 1;
+
+    // A 30-frame burst plus scattered losses, including two parity rows.
+    std::vector<std::uint16_t> dropped;
+    for (std::uint16_t i = 700; i < 730; ++i) dropped.push_back(i);
+    for (std::uint16_t i : { 3, 512, 1999, 1500, 256, 255 }) dropped.push_back(i);
+    dropped.push_back(N + 0);
+    dropped.push_back(N + 17);
+
+    RxBlockTable rxt({ .reorder_ms = 50, .fps = 30, .max_payload_len = 1300 });
+    const std::uint64_t t0 = 1000;
+    for (std::size_t i = 0; i < frames.size(); ++i) {
+        if (std::find(dropped.begin(), dropped.end(), static_cast<std::uint16_t>(i)) != dropped.end()) continue;
+        BaseHeader h{}; bool hasp = false; ParitySubheader ps{}; std::span<const std::byte> pl; std::uint32_t crc = 0;
+        BOOST_TEST(decode_frame(std::span<const std::byte>(frames[i].data(), frames[i].size()), h, hasp, ps, pl, crc));
+        if (hasp) BOOST_TEST(ps.fec_scheme_id == static_cast<std::uint8_t>(fec_scheme_id::cauchy_gf65536));
+        BOOST_TEST(rxt.ingest(t0, h, hasp, ps, pl));
+    }
+
+    RxClosedBlock closed{};
+    BOOST_TEST(rxt.close_if_ready(gen, t0 + 60, closed));
+    for (auto i : dropped) {
+        if (i >= N) continue;
+        BOOST_TEST(closed.was_recovered[i]);
+        BOOST_TEST((closed.data[i] == payloads[i]));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(odd_length_padded_to_whole_symbols) {
+    // Odd payloads are protected as if zero-padded by one byte; their common length travels with
+    // the parity.
+    const std::uint16_t N = 300, K = 4;
+    const std::size_t L = 11;
+    TxBlockAssembler tx({ .N = N, .K = K, .max_payload_len = 1300 }, 1u);
+    const auto payloads = random_frames(N, L, 4u);
+    std::vector<std::span<const std::byte>> data;
+    for (const auto& p : payloads) data.emplace_back(p.data(), p.size());
+    std::vector<std::vector<std::byte>> frames;
+    BOOST_TEST(tx.assemble_block(data, frames));
+
+    RxBlockTable rxt({ .reorder_ms = 50, .fps = 30, .max_payload_len = 1300 });
+    for (std::size_t i = 0; i < frames.size(); ++i) {
+        if (i == 10 || i == 299) continue;
+        BaseHeader h{}; bool hasp = false; ParitySubheader ps{}; std::span<const std::byte> pl; std::uint32_t crc = 0;
+        BOOST_TEST(decode_frame(std::span<const std::byte>(frames[i].data(), frames[i].size()), h, hasp, ps, pl, crc));
+        if (hasp) BOOST_TEST(pl.size() == L + 1 + varlen_table_size(1));
+        if (hasp) BOOST_TEST((h.flags1 & k_flags1_common_len) != 0);
+        BOOST_TEST(rxt.ingest(1000, h, hasp, ps, pl));
+    }
+    RxClosedBlock closed{};
+    BOOST_TEST(rxt.close_if_ready(tx.peek_next_gen() - 1, 1060, closed));
+    BOOST_TEST(closed.payload_len == L + 1);
+    BOOST_TEST(closed.was_recovered[10]);
+    BOOST_TEST(closed.was_recovered[299]);
+    BOOST_TEST((closed.data[10] == payloads[10]));
+    BOOST_TEST((closed.data[299] == payloads[299]));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,149 @@
+#include <boost/test/unit_test.hpp>  // not the included runner
+#include <ltfec/pipeline/lt_fountain.h>
+#include <ltfec/fec_core/lt_code.h>
+#include <ltfec/protocol/frame_builder.h>
+#include <ltfec/protocol/ids.h>
+#include <ltfec/sim/rng.h>
+#include "test_frames.h"
+#include <algorithm>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+using namespace ltfec::pipeline;
+using namespace ltfec::protocol;
+
+namespace {
+    std::vector<std::span<const std::byte>> spans_of(const std::vector<std::vector<std::byte>>& v) {
+        std::vector<std::span<const std::byte>> s;
+        for (const auto& p : v) s.emplace_back(p.data(), p.size());
+        return s;
+    }
+
+    bool feed(LtDecoder& rx, const std::vector<std::byte>& frame) {
+        BaseHeader h{}; bool hasp = false; ParitySubheader ps{}; std::span<const std::byte> pl; std::uint32_t crc = 0;
+        if (!decode_frame(std::span<const std::byte>(frame.data(), frame.size()), h, hasp, ps, pl, crc)) return false;
+        return rx.ingest(h, hasp, ps, pl);
+    }
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(lt_fountain_suite)
+
+BOOST_AUTO_TEST_CASE(degree_distribution_and_neighbors) {
+    const std::size_t N = 200;
+    const auto cdf = ltfec::fec_core::lt_robust_soliton_cdf(N);
+    BOOST_TEST(cdf.size() == N);
+    BOOST_TEST(std::is_sorted(cdf.begin(), cdf.end()));
+    BOOST_TEST(cdf.back() == 0xFFFFFFFFu);
+
+    std::vector<std::uint16_t> a, b;
+    double total = 0;
+    for (std::uint32_t esi = 200; esi < 1200; ++esi) {
+        ltfec::fec_core::lt_neighbors(7u, esi, N, cdf, a);
+        ltfec::fec_core::lt_neighbors(7u, esi, N, cdf, b);
+        BOOST_TEST((a == b)); // deterministic from (gen, esi)
+        BOOST_TEST(!a.empty());
+        std::sort(a.begin(), a.end());
+        BOOST_TEST((std::adjacent_find(a.begin(), a.end()) == a.end()));
+        BOOST_TEST(a.back() < N);
+        total += static_cast<double>(a.size());
+    }
+    // Robust soliton mean degree is O(ln N); keeps the XOR work per symbol small.
+    BOOST_TEST(total / 1000.0 < 15.0);
+}
+
+BOOST_AUTO_TEST_CASE(any_frames_finish_near_N) {
+    // 40% random loss on an endless symbol stream: the receiver completes from whichever
+    // frames arrive.
+    const std::size_t N = 500;
+    const auto obj = random_frames(N, 256, 99u);
+    LtEncoder tx;
+    BOOST_TEST(tx.start_object(42u, spans_of(obj)));
+    LtDecoder rx;
+
+    ltfec::sim::XorShift32 loss(1234u);
+    std::vector<std::byte> frame;
+    while (!rx.complete()) {
+        BOOST_REQUIRE(tx.next_frame(frame));
+        if (loss.next_unit() < 0.4) continue;
+        BOOST_TEST(feed(rx, frame));
+    }
+
+    RxClosedBlock out;
+    BOOST_TEST(rx.extract(out));
+    BOOST_TEST(out.gen == 42u);
+    BOOST_TEST(out.N == N);
+    BOOST_TEST(out.K == 0u);
+    std::size_t recovered = 0;
+    for (std::size_t i = 0; i < N; ++i) {
+        BOOST_TEST((out.data[i] == obj[i]));
+        recovered += out.was_recovered[i] ? 1 : 0;
+    }
+    BOOST_TEST(recovered > 0u);
+}
+
+BOOST_AUTO_TEST_CASE(mean_reception_overhead_over_seeds) {
+    // Frames received before completion, averaged over objects and loss patterns. Without a
+    // precode the peeling decoder needs every lost source covered by some repair symbol, so
+    // the overhead is well above RaptorQ's (see DESIGN.md, LT fountain). These bounds pin the
+    // measured means (about 1.31 at 40% loss and 1.40 at 20%) so a regression shows up.
+    const std::size_t N = 500;
+    const int runs = 10;
+    for (const double p : { 0.2, 0.4 }) {
+        double sum = 0;
+        for (int r = 0; r < runs; ++r) {
+            const auto obj = random_frames(N, 32, 1000u + static_cast<std::uint32_t>(r));
+            LtEncoder tx;
+            BOOST_REQUIRE(tx.start_object(10u + static_cast<std::uint32_t>(r), spans_of(obj)));
+            LtDecoder rx;
+            ltfec::sim::XorShift32 loss(77u + 13u * static_cast<std::uint32_t>(r));
+            std::vector<std::byte> frame;
+            while (!rx.complete()) {
+                BOOST_REQUIRE(tx.next_frame(frame));
+                if (loss.next_unit() < p) continue;
+                BOOST_REQUIRE(feed(rx, frame));
+            }
+            sum += static_cast<double>(rx.frames_received()) / static_cast<double>(N);
+        }
+        const double mean = sum / runs;
+        BOOST_TEST_MESSAGE("LT N=" << N << " loss=" << p << " mean overhead " << mean);
+        BOOST_TEST(mean > 1.0);
+        BOOST_TEST(mean < (p < 0.3 ? 1.50 : 1.40));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(repair_only_and_foreign_frames) {
+    // No source frame at all: repair symbols alone still decode.
+    const std::size_t N = 64;
+    const auto obj = random_frames(N, 100, 5u);
+    LtEncoder tx;
+    BOOST_TEST(tx.start_object(3u, spans_of(obj)));
+    LtDecoder rx;
+
+    std::vector<std::byte> frame;
+    std::uint16_t esi = static_cast<std::uint16_t>(N);
+    while (!rx.complete() && esi < 2000) {
+        BOOST_REQUIRE(tx.encode_symbol(esi++, frame));
+        BOOST_TEST(feed(rx, frame));
+        BOOST_TEST(feed(rx, frame)); // duplicates are harmless
+    }
+    BOOST_TEST(rx.complete());
+
+    // Frames of another object or scheme are refused.
+    const auto other = random_frames(N, 100, 6u);
+    LtEncoder tx2;
+    BOOST_TEST(tx2.start_object(4u, spans_of(other)));
+    BOOST_TEST(tx2.next_frame(frame));
+    BOOST_TEST(!feed(rx, frame));
+
+    RxClosedBlock out;
+    BOOST_TEST(rx.extract(out));
+    for (std::size_t i = 0; i < N; ++i) BOOST_TEST((out.data[i] == obj[i]));
+
+    // Ragged sources are refused on TX.
+    auto ragged = random_frames(4, 32, 1u);
+    ragged[2].resize(31);
+    BOOST_TEST(!tx.start_object(5u, spans_of(ragged)));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
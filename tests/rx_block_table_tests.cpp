@@ -2,6 +2,9 @@
 #include <ltfec/pipeline/tx_block_assembler.h>
 #include <ltfec/pipeline/rx_block_table.h>
 #include <ltfec/protocol/frame_builder.h>
+#include <ltfec/protocol/ids.h>
+#include <algorithm>
+#include <optional>
 
 using namespace ltfec::pipeline;
 using namespace ltfec::protocol;
@@ -85,4 +88,388 @@ BOOST_AUTO_TEST_CASE(close_by_reorder_ms_if_earlier) {
     BOOST_TEST(rxt.should_close(gen, t0 + 50));
 }
 
+BOOST_AUTO_TEST_CASE(variable_length_block_recovers_exact_lengths) {
+    // Payload lengths differ within the block; recovered frames come back at their own length.
+    struct Case { std::uint16_t N, K; std::uint8_t scheme, cols; std::vector<std::uint16_t> drop; };
+    const std::vector<Case> cases = {
+        { 4, 1, 0, 0, { 2 } },                       // XOR
+        { 6, 3, 0, 0, { 1, 2, 5 } },                 // GF(256) Vandermonde
+        { 20, 8, 0, 0, { 0, 2, 7, 13, 19 } },        // Cauchy GF(256)
+        { 6, 5, static_cast<std::uint8_t>(fec_scheme_id::xor_2d), 3, { 2, 4 } },
+    };
+    for (const auto& c : cases) {
+        TxBlockAssembler tx({ .N = c.N, .K = c.K, .max_payload_len = 1300, .fec_scheme_id = c.scheme, .columns = c.cols }, 50u);
+        std::vector<std::vector<std::byte>> payloads(c.N);
+        for (std::uint16_t i = 0; i < c.N; ++i) {
+            payloads[i].resize(1u + (i * 37u) % 200u);
+            for (std::size_t k = 0; k < payloads[i].size(); ++k) payloads[i][k] = std::byte{ static_cast<unsigned char>(i * 7 + k) };
+        }
+        std::vector<std::span<const std::byte>> data;
+        for (const auto& p : payloads) data.emplace_back(p.data(), p.size());
+
+        std::vector<std::vector<std::byte>> frames;
+        BOOST_TEST(tx.assemble_block(data, frames));
+        const std::uint32_t gen = tx.peek_next_gen() - 1;
+
+        RxBlockTable rxt({ .reorder_ms = 50, .fps = 30, .max_payload_len = 1300 });
+        for (std::size_t i = 0; i < frames.size(); ++i) {
+            if (std::find(c.drop.begin(), c.drop.end(), static_cast<std::uint16_t>(i)) != c.drop.end()) continue;
+            BaseHeader h{}; bool hasp = false; ParitySubheader ps{}; std::span<const std::byte> pl; std::uint32_t crc = 0;
+            BOOST_TEST(decode_frame(std::span<const std::byte>(frames[i].data(), frames[i].size()), h, hasp, ps, pl, crc));
+            BOOST_TEST(rxt.ingest(1000, h, hasp, ps, pl));
+        }
+        RxClosedBlock closed{};
+        BOOST_TEST(rxt.close_if_ready(gen, 1060, closed));
+        std::size_t width = 0;
+        for (const auto& p : payloads) width = std::max(width, p.size());
+        BOOST_TEST(closed.payload_len == width);
+        for (std::uint16_t i = 0; i < c.N; ++i) {
+            const bool dropped = std::find(c.drop.begin(), c.drop.end(), i) != c.drop.end();
+            BOOST_TEST(closed.was_recovered[i] == dropped);
+            BOOST_TEST((closed.data[i] == payloads[i]));
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(lazy_crc_turns_corrupt_frames_into_erasures) {
+    // Corrupt payload bytes (trailer untouched): eager mode refuses the frame on ingest, lazy mode
+    // accepts it and drops it at close, recovering it from parity when enough is left.
+    struct Case { std::uint16_t N, K; std::vector<std::size_t> corrupt, drop; std::uint16_t want_corrupt; bool recovered; };
+    const std::vector<Case> cases = {
+        { 4, 1, { 1 }, {}, 1, true },            // XOR: corrupt data recovered from parity
+        { 4, 1, { 4 }, {}, 0, false },           // parity never needed: never checked
+        { 6, 3, { 0, 7 }, { 3 }, 2, true },      // Vandermonde: corrupt data + corrupt parity + loss
+        { 6, 3, { 0, 1, 2, 3 }, {}, 4, false },  // more erasures than parity
+    };
+    for (const auto& c : cases) {
+        TxBlockAssembler tx({ .N = c.N, .K = c.K, .max_payload_len = 1300 }, 90u);
+        std::vector<std::vector<std::byte>> payloads(c.N, std::vector<std::byte>(64));
+        for (std::uint16_t i = 0; i < c.N; ++i) {
+            for (std::size_t k = 0; k < 64; ++k) payloads[i][k] = std::byte{ static_cast<unsigned char>(i * 31 + k) };
+        }
+        std::vector<std::span<const std::byte>> data;
+        for (const auto& p : payloads) data.emplace_back(p.data(), p.size());
+        std::vector<std::vector<std::byte>> frames;
+        BOOST_TEST(tx.assemble_block(data, frames));
+        const std::uint32_t gen = tx.peek_next_gen() - 1;
+        for (auto i : c.corrupt) frames[i][FrameSizes::kBase + (i >= c.N ? FrameSizes::kParitySub : 0) + 5] ^= std::byte{ 0x40 };
+
+        RxBlockTable eager({ .reorder_ms = 50, .fps = 30, .max_payload_len = 1300 });
+        RxBlockTable lazy({ .reorder_ms = 50, .fps = 30, .max_payload_len = 1300, .lazy_crc = true });
+        for (std::size_t i = 0; i < frames.size(); ++i) {
+            if (std::find(c.drop.begin(), c.drop.end(), i) != c.drop.end()) continue;
+            BaseHeader h{}; bool hasp = false; ParitySubheader ps{}; std::span<const std::byte> pl; std::uint32_t crc = 0;
+            BOOST_TEST(decode_frame(std::span<const std::byte>(frames[i].data(), frames[i].size()), h, hasp, ps, pl, crc));
+            const bool bad = std::find(c.corrupt.begin(), c.corrupt.end(), i) != c.corrupt.end();
+            BOOST_TEST(eager.ingest(1000, h, hasp, ps, pl, crc) == !bad);
+            BOOST_TEST(lazy.ingest(1000, h, hasp, ps, pl, crc));
+        }
+
+        RxClosedBlock closed{};
+        BOOST_TEST(lazy.close_if_ready(gen, 1060, closed));
+        BOOST_TEST(closed.corrupt == c.want_corrupt);
+        for (std::uint16_t i = 0; i < c.N; ++i) {
+            const bool erased = std::find(c.corrupt.begin(), c.corrupt.end(), i) != c.corrupt.end() ||
+                std::find(c.drop.begin(), c.drop.end(), i) != c.drop.end();
+            if (!erased) BOOST_TEST((closed.data[i] == payloads[i]));
+            else if (c.recovered) BOOST_TEST((closed.was_recovered[i] && closed.data[i] == payloads[i]));
+            else BOOST_TEST(closed.data[i].empty());
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(generation_ring_with_overflow_map) {
+    RxBlockTable rxt({ .reorder_ms = 50, .fps = 30, .max_payload_len = 1300, .gen_window = 4 });
+    BOOST_TEST(rxt.ring_size() == 4u);
+
+    const std::vector<std::byte> one(8, std::byte{ 1 });
+    auto open = [&](std::uint32_t gen) {
+        BaseHeader h{};
+        h.fec_gen_id = gen; h.seq_in_block = 0; h.data_count = 2; h.parity_count = 1; h.payload_len = 8;
+        return rxt.ingest(1000, h, false, ParitySubheader{}, std::span<const std::byte>(one));
+    };
+
+    // 100..107 all stay open: the four newest sit in the ring, the older ones were pushed out
+    for (std::uint32_t g = 100; g < 108; ++g) BOOST_TEST(open(g));
+    BOOST_TEST(rxt.open_blocks() == 8u);
+    BOOST_TEST(rxt.overflow_blocks() == 4u);
+    BOOST_TEST(open(90));                      // late generation, behind the window
+    BOOST_TEST(rxt.overflow_blocks() == 5u);
+    BOOST_TEST(rxt.snapshot(90).has_value());
+    BOOST_TEST(rxt.snapshot(101)->data_seen == 1u);
+    for (std::uint32_t g : { 90u, 100u, 101u, 102u, 103u, 104u, 105u, 106u, 107u }) {
+        RxClosedBlock out;
+        BOOST_TEST(rxt.close_if_ready(g, 5000, out));
+        BOOST_TEST(out.gen == g);
+    }
+    BOOST_TEST(rxt.open_blocks() == 0u);
+
+    // Serial order across the 32-bit wrap, and the 16-bit wrap of v2 generations (taken as a
+    // restart of the window, since 0 is far behind 0xFFFF as a 32-bit serial number)
+    for (const auto& gens : { std::vector<std::uint32_t>{ 0xFFFFFFFEu, 0xFFFFFFFFu, 0u, 1u },
+                              std::vector<std::uint32_t>{ 0xFFFEu, 0xFFFFu, 0u, 1u } }) {
+        RxBlockTable wrap({ .reorder_ms = 50, .fps = 30, .max_payload_len = 1300, .gen_window = 4 });
+        for (std::uint32_t g : gens) {
+            BaseHeader h{};
+            h.fec_gen_id = g; h.seq_in_block = 0; h.data_count = 2; h.parity_count = 1; h.payload_len = 8;
+            BOOST_TEST(wrap.ingest(1000, h, false, ParitySubheader{}, std::span<const std::byte>(one)));
+        }
+        BOOST_TEST(wrap.open_blocks() == 4u);
+        BOOST_TEST(wrap.overflow_blocks() == 0u);
+        for (std::uint32_t g : gens) BOOST_TEST(wrap.snapshot(g).has_value());
+    }
+}
+
+BOOST_AUTO_TEST_CASE(ring_slot_reuse_across_block_shapes) {
+    // gen 200 and 204 share a slot of a 4-slot ring; the second block has another N/K/width.
+    RxBlockTable rxt({ .reorder_ms = 50, .fps = 30, .max_payload_len = 1300, .gen_window = 4 });
+    struct Case { std::uint32_t gen; std::uint16_t N, K; std::size_t len; std::vector<std::size_t> lost; };
+    const Case cases[] = { { 200, 3, 1, 40, { 1 } }, { 204, 5, 2, 24, { 0, 3 } }, { 208, 2, 1, 60, { 1 } } };
+    for (const auto& c : cases) {
+        TxConfig cfg{ .N = c.N, .K = c.K, .max_payload_len = 1300 };
+        TxBlockAssembler tx(cfg, c.gen);
+        std::vector<std::vector<std::byte>> payloads(c.N, std::vector<std::byte>(c.len));
+        for (std::uint16_t i = 0; i < c.N; ++i) {
+            for (std::size_t k = 0; k < c.len; ++k) payloads[i][k] = std::byte{ static_cast<unsigned char>(c.gen + i * 5 + k) };
+        }
+        std::vector<std::span<const std::byte>> data;
+        for (const auto& p : payloads) data.emplace_back(p.data(), p.size());
+        std::vector<std::vector<std::byte>> frames;
+        BOOST_TEST(tx.assemble_block(data, frames));
+
+        for (std::size_t f = 0; f < frames.size(); ++f) {
+            if (std::find(c.lost.begin(), c.lost.end(), f) != c.lost.end()) continue;
+            BaseHeader h{}; bool hasp = false; ParitySubheader ps{}; std::span<const std::byte> pl; std::uint32_t crc = 0;
+            BOOST_TEST(decode_frame(std::span<const std::byte>(frames[f].data(), frames[f].size()), h, hasp, ps, pl, crc));
+            BOOST_TEST(rxt.ingest(2000, h, hasp, ps, pl));
+        }
+        BOOST_TEST(rxt.overflow_blocks() == 0u);
+
+        RxClosedBlock out;
+        BOOST_REQUIRE(rxt.close_if_ready(c.gen, 3000, out)); // losses: closes by timer
+        BOOST_TEST(out.N == c.N);
+        for (std::uint16_t i = 0; i < c.N; ++i) BOOST_TEST((out.data[i] == payloads[i]));
+        for (std::size_t i : c.lost) BOOST_TEST(out.was_recovered[i]);
+        BOOST_TEST(rxt.open_blocks() == 0u);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(poll_closes_due_blocks_exactly_once) {
+    // N=2, fps=30: rule (3) closes 50 ms after a block's first frame.
+    RxBlockTable rxt({ .reorder_ms = 50, .fps = 30, .max_payload_len = 1300 });
+    const std::vector<std::byte> one(8, std::byte{ 1 });
+    auto frame = [&](std::uint64_t t, std::uint32_t gen, std::uint16_t seq) {
+        BaseHeader h{};
+        h.fec_gen_id = gen; h.seq_in_block = seq; h.data_count = 2; h.parity_count = 1; h.payload_len = 8;
+        ParitySubheader ps{};
+        ps.fec_scheme_id = static_cast<std::uint8_t>(fec_scheme_id::xor_k1);
+        return rxt.ingest(t, h, seq >= 2, ps, std::span<const std::byte>(one));
+    };
+    std::vector<std::uint32_t> got;
+    auto collect = [&](RxClosedBlock&& b) { got.push_back(b.gen); };
+
+    BOOST_TEST(frame(1000, 1, 0));
+    BOOST_TEST(frame(1000, 2, 0));
+    BOOST_TEST(frame(1001, 3, 0));
+    BOOST_TEST(frame(1002, 2, 1));
+    BOOST_TEST(frame(1002, 2, 2));  // gen 2 complete: fast path
+    BOOST_TEST(rxt.poll(1002, collect) == 1u);
+    BOOST_TEST((got == std::vector<std::uint32_t>{ 2 }));
+
+    BOOST_TEST(rxt.poll(1049, collect) == 0u);
+    BOOST_TEST(rxt.poll(1050, collect) == 1u);
+    BOOST_TEST(got.back() == 1u);
+    RxClosedBlock out;
+    BOOST_TEST(rxt.close_if_ready(3, 1051, out));  // closed by hand: its timer goes stale
+    BOOST_TEST(rxt.poll(1100, collect) == 0u);
+    BOOST_TEST(rxt.open_blocks() == 0u);
+
+    // Polled long after a deadline (more than a turn of the wheel)
+    BOOST_TEST(frame(3000, 4, 0));
+    BOOST_TEST(rxt.poll(10000, collect) == 1u);
+    BOOST_TEST(got.back() == 4u);
+
+    // Many generations in flight (ring and overflow), polled every millisecond: each block is
+    // emitted once, at the first poll at or after its deadline.
+    std::vector<std::uint64_t> opened_at(600, 0);
+    std::vector<int> closes(600, 0);
+    auto check = [&](RxClosedBlock&& b) {
+        const std::uint32_t g = b.gen - 100;
+        BOOST_REQUIRE(g < closes.size());
+        ++closes[g];
+    };
+    std::uint64_t t = 20000;
+    for (std::uint32_t g = 0; g < 600; ++g, ++t) {
+        BOOST_TEST(frame(t, 100 + g, 0));
+        opened_at[g] = t;
+        rxt.poll(t, [&](RxClosedBlock&& b) {
+            BOOST_TEST(t == opened_at[b.gen - 100] + 50);
+            check(std::move(b));
+        });
+    }
+    for (; t < 20000 + 600 + 60; ++t) {
+        rxt.poll(t, [&](RxClosedBlock&& b) {
+            BOOST_TEST(t == opened_at[b.gen - 100] + 50);
+            check(std::move(b));
+        });
+    }
+    BOOST_TEST(std::all_of(closes.begin(), closes.end(), [](int c) { return c == 1; }));
+    BOOST_TEST(rxt.open_blocks() == 0u);
+}
+
+BOOST_AUTO_TEST_CASE(slab_storage_is_pooled_and_grows_with_the_block) {
+    RxBlockTable rxt({ .reorder_ms = 50, .fps = 30, .max_payload_len = 1300 });
+    const std::size_t lens[4] = { 8, 200, 100, 50 };  // first frame suggests a narrow block
+
+    auto payload = [&](std::uint32_t gen, std::size_t i) {
+        std::vector<std::byte> p(lens[i]);
+        for (std::size_t b = 0; b < p.size(); ++b) p[b] = static_cast<std::byte>(gen * 7 + i * 31 + b);
+        return p;
+    };
+    auto header = [](std::uint32_t gen, std::uint16_t seq, std::size_t len) {
+        BaseHeader h{};
+        h.fec_gen_id = gen; h.seq_in_block = seq; h.data_count = 4; h.parity_count = 1;
+        h.payload_len = static_cast<std::uint16_t>(len);
+        return h;
+    };
+
+    std::size_t after_first = 0;
+    for (std::uint32_t gen = 1; gen <= 100; ++gen) {
+        const std::uint64_t t = 1000 + gen;
+        std::vector<std::byte> parity(200, std::byte{ 0 });
+        for (std::uint16_t i = 0; i < 4; ++i) {
+            const auto p = payload(gen, i);
+            for (std::size_t b = 0; b < p.size(); ++b) parity[b] ^= p[b];
+            if (i == 2) continue;  // lost
+            BOOST_TEST(rxt.ingest(t, header(gen, i, p.size()), false, ParitySubheader{}, std::span<const std::byte>(p)));
+        }
+        ParitySubheader ps{};
+        ps.fec_scheme_id = static_cast<std::uint8_t>(fec_scheme_id::xor_k1);
+        BOOST_TEST(rxt.ingest(t, header(gen, 4, parity.size()), true, ps, std::span<const std::byte>(parity)));
+
+        RxClosedBlock out;
+        BOOST_REQUIRE(rxt.close_if_ready(gen, t + 1000, out));
+        BOOST_TEST(out.was_recovered[2]);
+        const auto lost = payload(gen, 2);
+        BOOST_REQUIRE(out.data[2].size() == 200u);  // no length table: block width
+        BOOST_TEST(std::equal(lost.begin(), lost.end(), out.data[2].begin()));
+        BOOST_TEST(std::all_of(out.data[2].begin() + 100, out.data[2].end(), [](std::byte b) { return b == std::byte{ 0 }; }));
+        for (std::uint16_t i : { 0, 1, 3 }) BOOST_TEST((out.data[i] == payload(gen, i)));
+
+        if (gen == 1) after_first = rxt.pool().allocations();
+    }
+    // The narrow slab and the one it grew into are reused by every later block.
+    BOOST_TEST(after_first == 2u);
+    BOOST_TEST(rxt.pool().allocations() == after_first);
+    BOOST_TEST(rxt.pool().free_slabs() == after_first);
+}
+
+BOOST_AUTO_TEST_CASE(slab_pool_free_list_is_capped) {
+    RxSlabPool pool(/*max_free*/ 2, /*max_free_bytes*/ 1024);
+    std::vector<RxSlabPool::Slab> held;
+    for (int i = 0; i < 3; ++i) held.push_back(pool.acquire(256));
+    for (auto& s : held) pool.release(std::move(s));
+    BOOST_TEST(pool.free_slabs() == 2u);      // the third is freed
+    BOOST_TEST(pool.free_bytes() == 512u);
+
+    pool.release(pool.acquire(4096));         // larger than the byte budget: never kept
+    BOOST_TEST(pool.free_slabs() == 2u);
+    BOOST_TEST(pool.free_bytes() == 512u);
+
+    auto s = pool.acquire(200);               // reused, not allocated
+    BOOST_TEST(s.capacity() == 256u);
+    BOOST_TEST(pool.allocations() == 4u);
+    BOOST_TEST(pool.free_bytes() == 256u);
+}
+
+BOOST_AUTO_TEST_CASE(leases_view_the_block_storage_and_return_it) {
+    TxConfig txcfg{ .N = 4, .K = 2, .max_payload_len = 1300 };
+    TxBlockAssembler tx(txcfg, /*gen_seed*/ 50u);
+    std::vector<std::vector<std::byte>> payloads(4);
+    for (std::size_t i = 0; i < 4; ++i) payloads[i].assign(40 + i, static_cast<std::byte>(0x30 + i));
+    std::vector<std::span<const std::byte>> data(payloads.begin(), payloads.end());
+    std::vector<std::vector<std::byte>> frames;
+    BOOST_REQUIRE(tx.assemble_block(data, frames));
+    const std::uint32_t gen = tx.peek_next_gen() - 1;
+
+    std::optional<RxBlockLease> kept;
+    {
+        RxBlockTable rxt({ .reorder_ms = 50, .fps = 30, .max_payload_len = 1300 });
+        for (std::size_t f = 0; f < frames.size(); ++f) {
+            if (f == 1 || f == 3) continue;  // two data frames lost
+            BaseHeader h{}; bool hasp = false; ParitySubheader ps{}; std::span<const std::byte> pl; std::uint32_t crc = 0;
+            BOOST_REQUIRE(decode_frame(std::span<const std::byte>(frames[f].data(), frames[f].size()), h, hasp, ps, pl, crc));
+            BOOST_TEST(rxt.ingest(1000, h, hasp, ps, pl));
+        }
+
+        std::size_t calls = 0;
+        BOOST_TEST(rxt.poll(2000, [&](RxBlockLease&& lease) {
+            ++calls;
+            BOOST_TEST(lease.gen() == gen);
+            BOOST_TEST(rxt.pool().free_slabs() == 0u);  // still held by the lease
+            for (std::uint16_t i = 0; i < 4; ++i) {
+                BOOST_REQUIRE(lease.present(i));
+                BOOST_TEST(lease.was_recovered(i) == (i == 1 || i == 3));
+                const auto v = lease.data(i);
+                // Mixed lengths: the length table cuts recovered frames back to size.
+                BOOST_TEST((std::vector<std::byte>(v.begin(), v.end()) == payloads[i]));
+            }
+            kept = std::move(lease);
+        }) == 1u);
+        BOOST_TEST(calls == 1u);
+        BOOST_TEST(rxt.pool().free_slabs() == 0u);
+        BOOST_TEST(kept->present(0));
+    }
+    // The lease outlives the table (and keeps the pool alive until released).
+    BOOST_TEST(std::equal(payloads[2].begin(), payloads[2].end(), kept->data(2).begin()));
+    kept->release();
+    BOOST_TEST(!kept->present(0));
+    BOOST_TEST(kept->data(0).empty());
+}
+
+BOOST_AUTO_TEST_CASE(pass_through_delivers_on_arrival_and_recovers_at_close) {
+    TxConfig txcfg{ .N = 4, .K = 1, .max_payload_len = 1300 };
+    TxBlockAssembler tx(txcfg, /*gen_seed*/ 900u);
+    std::vector<std::vector<std::byte>> payloads(4);
+    for (std::size_t i = 0; i < 4; ++i) payloads[i].assign(32, static_cast<std::byte>(0x41 + i));
+    std::vector<std::span<const std::byte>> data(payloads.begin(), payloads.end());
+    std::vector<std::vector<std::byte>> frames;
+    BOOST_REQUIRE(tx.assemble_block(data, frames));
+    const std::uint32_t gen = tx.peek_next_gen() - 1;
+
+    RxBlockTable rxt({ .reorder_ms = 50, .fps = 30, .max_payload_len = 1300, .lazy_crc = true });
+    std::vector<std::uint16_t> got;
+    auto on_data = [&](const RxDataFrame& f) {
+        BOOST_TEST(f.gen == gen);
+        BOOST_TEST((std::vector<std::byte>(f.payload.begin(), f.payload.end()) == payloads[f.seq]));
+        got.push_back(f.seq);
+    };
+    auto feed = [&](std::size_t f, bool corrupt = false) {
+        std::vector<std::byte> fr = frames[f];
+        if (corrupt) fr[fr.size() / 2] ^= std::byte{ 0x01 };
+        BaseHeader h{}; bool hasp = false; ParitySubheader ps{}; std::span<const std::byte> pl; std::uint32_t crc = 0;
+        BOOST_REQUIRE(decode_frame(std::span<const std::byte>(fr.data(), fr.size()), h, hasp, ps, pl, crc));
+        return rxt.ingest(1000, h, hasp, ps, pl, crc, on_data);
+    };
+
+    BOOST_TEST(feed(2));
+    BOOST_TEST((got == std::vector<std::uint16_t>{ 2 }));  // before the block is anywhere near closing
+    BOOST_TEST(!feed(1, /*corrupt*/true));                  // checked before delivery despite lazy CRC
+    BOOST_TEST(feed(0));
+    BOOST_TEST(feed(0));                                    // duplicate: not delivered again
+    BOOST_TEST(feed(3));
+    BOOST_TEST(feed(4));                                    // parity
+    BOOST_TEST((got == std::vector<std::uint16_t>{ 2, 0, 3 }));
+
+    RxClosedBlock out;
+    BOOST_REQUIRE(rxt.close_if_ready(gen, 2000, out));
+    BOOST_REQUIRE(out.delivered.size() == 4u);
+    for (std::uint16_t i = 0; i < 4; ++i) {
+        BOOST_TEST(out.delivered[i] == (i != 1));            // not lost, just sent already
+        BOOST_TEST(out.was_recovered[i] == (i == 1));
+        BOOST_TEST(out.data[i].empty() == (i != 1));        // only what was not delivered yet
+    }
+    BOOST_TEST((out.data[1] == payloads[1]));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
\ No newline at end of file
@@ -140,4 +140,40 @@ BOOST_AUTO_TEST_CASE(k3_recover_two_missing_with_only_two_parity_rows_present) {
     }
 }
 
+BOOST_AUTO_TEST_CASE(duplicates_and_explicit_scheme_still_recover) {
+    // K=2 forced to Cauchy: the receiver first folds syndromes assuming Vandermonde, then the
+    // parity subheader says otherwise and the block falls back to the full solve.
+    TxConfig txcfg{ .N = 4, .K = 2, .max_payload_len = 1300,
+                    .fec_scheme_id = static_cast<std::uint8_t>(ltfec::protocol::fec_scheme_id::cauchy_gf256) };
+    TxBlockAssembler tx(txcfg, /*gen_seed*/ 77u);
+
+    const auto d0 = to_bytes("q1w2e3");
+    const auto d1 = to_bytes("r4t5y6");
+    const auto d2 = to_bytes("u7i8o9");
+    const auto d3 = to_bytes("p0a1s2");
+    std::vector<std::span<const std::byte>> data = {
+        {d0.data(), d0.size()}, {d1.data(), d1.size()}, {d2.data(), d2.size()}, {d3.data(), d3.size()}
+    };
+
+    std::vector<std::vector<std::byte>> frames;
+    BOOST_TEST(tx.assemble_block(data, frames));
+    const std::uint32_t gen = tx.peek_next_gen() - 1;
+
+    RxBlockTable rxt({ .reorder_ms = 50, .fps = 30, .max_payload_len = 1300 });
+    const std::uint64_t t0 = 2000;
+    auto feed = [&](std::size_t i) {
+        BaseHeader h{}; bool hasp = false; ParitySubheader ps{}; std::span<const std::byte> pl; std::uint32_t crc = 0;
+        BOOST_TEST(decode_frame(std::span<const std::byte>(frames[i].data(), frames[i].size()), h, hasp, ps, pl, crc));
+        BOOST_TEST(rxt.ingest(t0, h, hasp, ps, pl));
+    };
+    feed(0); feed(0); feed(3); feed(4); feed(4); feed(5);   // data 1 and 2 lost; duplicates of 0 and parity 0
+
+    RxClosedBlock closed{};
+    BOOST_TEST(rxt.close_if_ready(gen, t0 + 60, closed));
+    BOOST_TEST(closed.was_recovered[1]);
+    BOOST_TEST(closed.was_recovered[2]);
+    BOOST_TEST((closed.data[1] == d1));
+    BOOST_TEST((closed.data[2] == d2));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
\ No newline at end of file
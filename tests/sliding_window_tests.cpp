@@ -0,0 +1,170 @@
+#include <boost/test/unit_test.hpp>  // not the included runner
+#include <ltfec/pipeline/sliding_window.h>
+#include <ltfec/protocol/frame_builder.h>
+#include <ltfec/protocol/ids.h>
+#include <ltfec/sim/rng.h>
+#include <ltfec/sim/loss.h>
+#include <map>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+using namespace ltfec::pipeline;
+using namespace ltfec::protocol;
+
+namespace {
+    std::vector<std::byte> make_payload(std::uint32_t esi, std::size_t len) {
+        ltfec::sim::XorShift32 rng(esi * 2654435761u + 1u);
+        std::vector<std::byte> v(len);
+        for (auto& b : v) b = std::byte{ static_cast<unsigned char>(rng.next_u32() & 0xFFu) };
+        return v;
+    }
+
+    // Decode one on-wire frame and hand it to the decoder.
+    bool feed(SlidingWindowDecoder& rx, const std::vector<std::byte>& frame, std::vector<RxSourceFrame>& out) {
+        BaseHeader h{}; bool hasp = false; ParitySubheader ps{}; std::span<const std::byte> pl; std::uint32_t crc = 0;
+        if (!decode_frame(std::span<const std::byte>(frame.data(), frame.size()), h, hasp, ps, pl, crc)) return false;
+        return rx.ingest(h, hasp, ps, pl, out);
+    }
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(sliding_window_suite)
+
+BOOST_AUTO_TEST_CASE(emits_repair_every_R_sources) {
+    SlidingWindowEncoder tx({ .W = 8, .R = 3, .max_payload_len = 1300 }, /*first_esi*/ 100u);
+    std::vector<std::vector<std::byte>> out;
+    for (std::uint32_t i = 0; i < 9; ++i) {
+        const auto p = make_payload(100u + i, 64);
+        BOOST_TEST(tx.push_data(std::span<const std::byte>(p.data(), p.size()), out));
+        BOOST_TEST(out.size() == ((i + 1) % 3 == 0 ? 2u : 1u));
+
+        BaseHeader h{}; bool hasp = false; ParitySubheader ps{}; std::span<const std::byte> pl; std::uint32_t crc = 0;
+        BOOST_TEST(decode_frame(std::span<const std::byte>(out[0].data(), out[0].size()), h, hasp, ps, pl, crc));
+        BOOST_TEST(!hasp);
+        BOOST_TEST(h.fec_gen_id == 100u + i);
+        BOOST_TEST((h.flags1 & k_flags1_sliding_window) != 0);
+        if (out.size() == 2) {
+            BOOST_TEST(decode_frame(std::span<const std::byte>(out[1].data(), out[1].size()), h, hasp, ps, pl, crc));
+            BOOST_TEST(hasp);
+            BOOST_TEST(ps.fec_scheme_id == static_cast<std::uint8_t>(fec_scheme_id::rlc_sliding));
+            const std::uint32_t w = std::min<std::uint32_t>(8u, i + 1);
+            BOOST_TEST(h.data_count == w);
+            BOOST_TEST(h.fec_gen_id == 100u + i + 1 - w);
+        }
+    }
+    const auto bad = make_payload(0, 65);
+    BOOST_TEST(!tx.push_data(std::span<const std::byte>(bad.data(), bad.size()), out));
+}
+
+BOOST_AUTO_TEST_CASE(recovers_burst_within_window_before_block_close) {
+    // W=8, R=2: a burst of 2 consecutive sources is repaired by the next repair frames, without
+    // waiting for any block boundary.
+    const SlidingWindowConfig cfg{ .W = 8, .R = 2, .max_payload_len = 1300 };
+    SlidingWindowEncoder tx(cfg);
+    SlidingWindowDecoder rx(cfg);
+
+    std::map<std::uint32_t, RxSourceFrame> got;
+    std::vector<std::vector<std::byte>> frames;
+    std::vector<RxSourceFrame> out;
+    std::uint32_t recovered_at = 0;
+    for (std::uint32_t i = 0; i < 16; ++i) {
+        const auto p = make_payload(i, 200);
+        BOOST_TEST(tx.push_data(std::span<const std::byte>(p.data(), p.size()), frames));
+        for (std::size_t f = 0; f < frames.size(); ++f) {
+            if (f == 0 && (i == 5 || i == 6)) continue; // burst on source frames 5 and 6
+            out.clear();
+            BOOST_TEST(feed(rx, frames[f], out));
+            for (auto& s : out) {
+                if (s.was_recovered && recovered_at == 0) recovered_at = i;
+                got[s.esi] = std::move(s);
+            }
+        }
+    }
+
+    BOOST_TEST(got.size() == 16u);
+    BOOST_TEST(got[5].was_recovered);
+    BOOST_TEST(got[6].was_recovered);
+    for (std::uint32_t i = 0; i < 16; ++i) BOOST_TEST((got[i].payload == make_payload(i, 200)));
+    BOOST_TEST(recovered_at <= 9u); // repaired within a couple of repair intervals
+    BOOST_TEST(rx.pending_equations() == 0u);
+}
+
+BOOST_AUTO_TEST_CASE(random_loss_recovery_and_wraparound) {
+    // Start near the ESI wrap point; 10% Bernoulli loss on every frame (source and repair).
+    const SlidingWindowConfig cfg{ .W = 16, .R = 4, .max_payload_len = 1300 };
+    const std::uint32_t first = 0xFFFFFF00u;
+    SlidingWindowEncoder tx(cfg, first);
+    SlidingWindowDecoder rx(cfg);
+    ltfec::sim::XorShift32 rng(2024u);
+    ltfec::sim::BernoulliLoss loss{ .p_loss = 0.10 };
+
+    const std::uint32_t count = 2000;
+    std::uint32_t lost = 0, delivered = 0, bad = 0;
+    std::vector<std::vector<std::byte>> frames;
+    std::vector<RxSourceFrame> out;
+    for (std::uint32_t i = 0; i < count; ++i) {
+        const auto p = make_payload(first + i, 100);
+        BOOST_TEST(tx.push_data(std::span<const std::byte>(p.data(), p.size()), frames));
+        for (std::size_t f = 0; f < frames.size(); ++f) {
+            if (loss.drop(rng)) { if (f == 0) ++lost; continue; }
+            out.clear();
+            BOOST_TEST(feed(rx, frames[f], out));
+            for (const auto& s : out) {
+                ++delivered;
+                if (s.payload != make_payload(s.esi, 100)) ++bad;
+            }
+        }
+    }
+
+    BOOST_TEST(bad == 0u);
+    BOOST_TEST(lost > 100u);
+    // 25% overhead against 10% loss: nearly everything comes back.
+    BOOST_TEST(count - delivered < lost / 5);
+}
+
+BOOST_AUTO_TEST_CASE(window_that_does_not_divide_the_esi_space) {
+    // W=3: ESIs 0xFFFFFFFF and 0 would share a slot if indexed by esi % W. Source 0xFFFFFFFF and
+    // its first repair are lost, so only the repair sent after the wrap can bring it back.
+    const SlidingWindowConfig cfg{ .W = 3, .R = 1, .max_payload_len = 1300 };
+    const std::uint32_t first = 0xFFFFFFF0u;
+    SlidingWindowEncoder tx(cfg, first);
+    SlidingWindowDecoder rx(cfg);
+
+    std::map<std::uint32_t, RxSourceFrame> got;
+    std::vector<std::vector<std::byte>> frames;
+    std::vector<RxSourceFrame> out;
+    for (std::uint32_t i = 0; i < 24; ++i) {
+        const auto p = make_payload(first + i, 48);
+        BOOST_TEST(tx.push_data(std::span<const std::byte>(p.data(), p.size()), frames));
+        if (first + i == 0xFFFFFFFFu) continue;
+        for (const auto& f : frames) {
+            out.clear();
+            BOOST_TEST(feed(rx, f, out));
+            for (auto& s : out) got[s.esi] = std::move(s);
+        }
+    }
+
+    BOOST_TEST(got.size() == 24u);
+    BOOST_TEST(got[0xFFFFFFFFu].was_recovered);
+    for (std::uint32_t i = 0; i < 24; ++i) BOOST_TEST((got[first + i].payload == make_payload(first + i, 48)));
+}
+
+BOOST_AUTO_TEST_CASE(rejects_foreign_frames) {
+    SlidingWindowDecoder rx({ .W = 4, .R = 2, .max_payload_len = 1300 });
+    std::vector<RxSourceFrame> out;
+    BaseHeader h{};
+    h.version = k_protocol_version;
+    h.flags1 = 0; // block-code frame
+    h.data_count = 4; h.parity_count = 1; h.payload_len = 4;
+    ParitySubheader ps{};
+    const std::vector<std::byte> p(4);
+    BOOST_TEST(!rx.ingest(h, false, ps, std::span<const std::byte>(p.data(), p.size()), out));
+
+    h.flags1 = k_flags1_sliding_window;
+    h.seq_in_block = 4;
+    ps.fec_scheme_id = static_cast<std::uint8_t>(fec_scheme_id::xor_k1);
+    BOOST_TEST(!rx.ingest(h, true, ps, std::span<const std::byte>(p.data(), p.size()), out));
+    BOOST_TEST(out.empty());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
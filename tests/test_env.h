@@ -0,0 +1,24 @@
+#pragma once
+#include <cctype>
+#include <cstdlib>
+#include <string>
+
+// Opt-in switches for the slow suites (LTFEC_BENCH, LTFEC_ACCEPT_FULL): true when the variable
+// is set to 1/true/yes/on (case and surrounding spaces ignored).
+inline bool env_flag(const char* name) {
+#ifdef _WIN32
+    char* buf = nullptr; size_t sz = 0;
+    if (_dupenv_s(&buf, &sz, name) != 0 || !buf) return false;
+    std::string v(buf); free(buf);
+#else
+    const char* c = std::getenv(name);
+    if (!c) return false;
+    std::string v(c);
+#endif
+    // trim + lower
+    auto issp = [](unsigned char ch) { return std::isspace(ch) != 0; };
+    while (!v.empty() && issp(v.front())) v.erase(v.begin());
+    while (!v.empty() && issp(v.back()))  v.pop_back();
+    for (auto& ch : v) ch = static_cast<char>(std::tolower(static_cast<unsigned char>(ch)));
+    return (v == "1" || v == "true" || v == "yes" || v == "on");
+}
\ No newline at end of file
@@ -0,0 +1,13 @@
+#pragma once
+#include <ltfec/sim/rng.h>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// n frames of len pseudo-random bytes, reproducible from seed.
+inline std::vector<std::vector<std::byte>> random_frames(std::size_t n, std::size_t len, std::uint32_t seed) {
+    ltfec::sim::XorShift32 rng(seed);
+    std::vector<std::vector<std::byte>> v(n, std::vector<std::byte>(len));
+    for (auto& f : v) for (auto& b : f) b = std::byte{ static_cast<unsigned char>(rng.next_u32() & 0xFFu) };
+    return v;
+}
@@ -96,4 +96,338 @@ BOOST_AUTO_TEST_CASE(gen_id_increments_per_block) {
     BOOST_TEST(h2.fec_gen_id == h1.fec_gen_id + 1u);
 }
 
+BOOST_AUTO_TEST_CASE(push_data_matches_assemble_block) {
+    // Incremental push must produce byte-identical frames to the batch path, for every scheme.
+    for (const std::uint16_t K : { 0, 1, 2, 4, 8 }) {
+        TxConfig cfg{ .N = 6, .K = K, .max_payload_len = 1300 };
+        TxBlockAssembler batch(cfg, /*gen_seed*/ 42u), inc(cfg, /*gen_seed*/ 42u);
+
+        std::vector<std::vector<std::byte>> payloads;
+        for (int i = 0; i < 6; ++i) payloads.push_back(to_bytes(std::string(40, static_cast<char>('a' + i * 7)) + std::to_string(100 + i * 31)));
+        std::vector<std::span<const std::byte>> spans;
+        for (const auto& p : payloads) spans.emplace_back(p.data(), p.size());
+
+        std::vector<std::vector<std::byte>> expected;
+        BOOST_TEST(batch.assemble_block(spans, expected));
+
+        std::vector<std::vector<std::byte>> got, out;
+        for (std::size_t i = 0; i < spans.size(); ++i) {
+            BOOST_TEST(inc.push_data(spans[i], out));
+            // Data frame is emitted immediately; parity only with the last payload.
+            BOOST_TEST(out.size() == (i + 1 == spans.size() ? 1u + K : 1u));
+            for (auto& f : out) got.push_back(std::move(f));
+        }
+        BOOST_TEST(inc.pushed_in_block() == 0u);
+        BOOST_TEST(got.size() == expected.size());
+        for (std::size_t i = 0; i < got.size() && i < expected.size(); ++i) {
+            BOOST_TEST((got[i] == expected[i]));
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(push_data_mixed_lengths_match_assemble_block) {
+    // Data frames keep their own sizes; parity covers the block width and carries the lengths.
+    TxConfig cfg{ .N = 3, .K = 2, .max_payload_len = 1300 };
+    TxBlockAssembler whole(cfg, /*gen_seed*/ 7u);
+    TxBlockAssembler inc(cfg, /*gen_seed*/ 7u);
+    const auto a = to_bytes("xxxx");
+    const auto b = to_bytes("yyyyyyyyy");
+    const auto c = to_bytes("zz");
+    const std::vector<std::span<const std::byte>> data = { {a.data(), a.size()}, {b.data(), b.size()}, {c.data(), c.size()} };
+
+    std::vector<std::vector<std::byte>> expected;
+    BOOST_TEST(whole.assemble_block(data, expected));
+
+    std::vector<std::vector<std::byte>> got, out;
+    for (const auto& p : data) {
+        BOOST_TEST(inc.push_data(p, out));
+        for (auto& f : out) got.push_back(std::move(f));
+    }
+    BOOST_TEST(got.size() == expected.size());
+    for (std::size_t i = 0; i < got.size() && i < expected.size(); ++i) BOOST_TEST((got[i] == expected[i]));
+
+    BaseHeader h{}; bool hasp = false; ParitySubheader ps{}; std::span<const std::byte> pl; std::uint32_t crc = 0;
+    BOOST_TEST(decode_frame(std::span<const std::byte>(expected[2].data(), expected[2].size()), h, hasp, ps, pl, crc));
+    BOOST_TEST(pl.size() == 2u);
+    BOOST_TEST(decode_frame(std::span<const std::byte>(expected[3].data(), expected[3].size()), h, hasp, ps, pl, crc));
+    BOOST_TEST(hasp);
+    BOOST_TEST((h.flags1 & k_flags1_varlen) != 0);
+    BOOST_TEST(pl.size() == 9u + varlen_table_size(3));
+    BOOST_TEST(u8(pl[9]) == 4u);   // lengths[0] = 4, u16 LE
+    BOOST_TEST(u8(pl[11]) == 9u);
+    BOOST_TEST(u8(pl[13]) == 2u);
+
+    // Empty payloads are still refused; a partial block can be abandoned.
+    BOOST_TEST(inc.push_data(data[0], out));
+    BOOST_TEST(!inc.push_data(std::span<const std::byte>{}, out));
+    BOOST_TEST(out.empty());
+    BOOST_TEST(inc.pushed_in_block() == 1u);
+    inc.abandon_block();
+    BOOST_TEST(inc.pushed_in_block() == 0u);
+    BOOST_TEST(inc.push_data(data[1], out));
+    BOOST_TEST(u8(out[0][0]) == static_cast<unsigned>(k_protocol_version));
+}
+
+BOOST_AUTO_TEST_CASE(xor_parity_crc_derived_from_data_crcs) {
+    // K=1 parity CRCs are computed from the data CRCs; they must match a pass over the bytes.
+    const std::vector<std::vector<std::string>> blocks = {
+        { "AAAAAA", "BBBBBB", "CCCCCC" },              // odd N, equal lengths
+        { "AAAA", "BBBB", "CCCC", "DDDD" },            // even N, equal lengths
+        { "xxxx", "yyyyyyyyy", "zz" },                 // odd N, padded
+        { "p", "qqqqqqqqqqqqq", "rrrrr", "ss" },       // even N, padded
+    };
+    for (const auto& blk : blocks) {
+        TxConfig cfg{ .N = static_cast<std::uint16_t>(blk.size()), .K = 1, .max_payload_len = 1300 };
+        TxBlockAssembler whole(cfg, 3u), inc(cfg, 3u);
+        std::vector<std::vector<std::byte>> bytes;
+        for (const auto& str : blk) bytes.push_back(to_bytes(str));
+        std::vector<std::span<const std::byte>> data;
+        for (const auto& v : bytes) data.emplace_back(v.data(), v.size());
+
+        std::vector<std::vector<std::byte>> frames, out;
+        BOOST_TEST(whole.assemble_block(data, frames));
+        for (const auto& d : data) BOOST_TEST(inc.push_data(d, out));
+        BOOST_TEST(out.size() == 2u);
+        BOOST_TEST((out[1] == frames.back()));
+
+        BaseHeader h{}; bool hasp = false; ParitySubheader ps{}; std::span<const std::byte> pl; std::uint32_t crc = 0;
+        BOOST_TEST(decode_frame(std::span<const std::byte>(frames.back().data(), frames.back().size()), h, hasp, ps, pl, crc));
+        BOOST_TEST(hasp);
+        BOOST_TEST(verify_payload_crc(pl, crc));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(push_data_parts_gather_to_same_datagrams) {
+    // header ++ payload ++ trailer must be byte-identical to the materialized data frame.
+    for (std::uint16_t K : { 1, 3 }) {
+        TxConfig cfg{ .N = 4, .K = K, .max_payload_len = 1300 };
+        TxBlockAssembler whole(cfg, 5u), parts(cfg, 5u);
+        const std::vector<std::string> strs = { "one", "twotwo", "three", "fourfourfour" };
+        std::vector<std::vector<std::byte>> out, parity;
+        TxDataFrameParts df;
+        for (std::size_t i = 0; i < strs.size(); ++i) {
+            const auto p = to_bytes(strs[i]);
+            BOOST_TEST(whole.push_data(std::span<const std::byte>(p.data(), p.size()), out));
+            BOOST_TEST(parts.push_data(std::span<const std::byte>(p.data(), p.size()), df, parity));
+
+            std::vector<std::byte> gathered(df.header.begin(), df.header.end());
+            gathered.insert(gathered.end(), p.begin(), p.end());
+            gathered.insert(gathered.end(), df.trailer.begin(), df.trailer.end());
+            BOOST_TEST((gathered == out[0]));
+            BOOST_TEST(parity.size() == (i + 1 == strs.size() ? K : 0u));
+            for (std::size_t j = 0; j < parity.size(); ++j) BOOST_TEST((parity[j] == out[1 + j]));
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(slab_output_matches_vector_output) {
+    // Same frames as the vector overload, each on a cache line, and a reused slab does not regrow.
+    struct Case { std::uint16_t N, K; bool varlen; };
+    const Case cases[] = { { 5, 1, false }, { 5, 1, true }, { 6, 3, false }, { 6, 3, true }, { 20, 8, true }, { 4, 0, false } };
+    for (const auto& c : cases) {
+        TxConfig cfg{ .N = c.N, .K = c.K, .max_payload_len = 1300 };
+        TxBlockAssembler vec_tx(cfg, 21u), slab_tx(cfg, 21u);
+        TxFrameSlab slab;
+        const std::byte* first_buf = nullptr;
+        for (int round = 0; round < 3; ++round) {
+            std::vector<std::vector<std::byte>> payloads(c.N);
+            for (std::uint16_t i = 0; i < c.N; ++i) {
+                payloads[i].resize(c.varlen ? 1u + (i * 97u + round * 13u) % 900u : 700u);
+                for (std::size_t k = 0; k < payloads[i].size(); ++k) payloads[i][k] = std::byte{ static_cast<unsigned char>(i + k * 3 + round) };
+            }
+            std::vector<std::span<const std::byte>> data;
+            for (const auto& p : payloads) data.emplace_back(p.data(), p.size());
+
+            std::vector<std::vector<std::byte>> frames;
+            BOOST_TEST(vec_tx.assemble_block(data, frames));
+            BOOST_TEST(slab_tx.assemble_block(std::span<const std::span<const std::byte>>(data), slab));
+            BOOST_TEST(slab.frame_count() == frames.size());
+            for (std::size_t f = 0; f < frames.size() && f < slab.frame_count(); ++f) {
+                const auto got = slab.frame(f);
+                BOOST_TEST((std::vector<std::byte>(got.begin(), got.end()) == frames[f]));
+                BOOST_TEST(slab.offsets()[f].offset % TxFrameSlab::kAlign == 0u);
+                BOOST_TEST(reinterpret_cast<std::uintptr_t>(got.data()) % TxFrameSlab::kAlign == 0u);
+            }
+            if (round == 0) first_buf = slab.data();
+            else if (!c.varlen) BOOST_TEST(slab.data() == first_buf); // same shape: storage reused
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(assemble_interleaved_round_robin) {
+    TxConfig cfg{ .N = 2, .K = 1, .max_payload_len = 1300, .interleave_depth = 3 };
+    TxBlockAssembler tx(cfg, /*gen_seed*/ 10u);
+
+    std::vector<std::vector<std::byte>> payloads;
+    for (int i = 0; i < 6; ++i) payloads.push_back(to_bytes(std::string(8, static_cast<char>('A' + i))));
+    std::vector<std::vector<std::span<const std::byte>>> blocks(3);
+    for (int b = 0; b < 3; ++b) {
+        for (int i = 0; i < 2; ++i) blocks[b].emplace_back(payloads[b * 2 + i].data(), payloads[b * 2 + i].size());
+    }
+
+    std::vector<std::vector<std::byte>> frames;
+    BOOST_TEST(tx.assemble_interleaved(blocks, frames));
+    BOOST_TEST(frames.size() == 9u); // D * (N + K)
+
+    // Wire order: (g10,0) (g11,0) (g12,0) (g10,1) (g11,1) (g12,1) (g10,P) (g11,P) (g12,P)
+    for (std::size_t k = 0; k < frames.size(); ++k) {
+        BaseHeader h{}; bool p = false; ParitySubheader ps{}; std::span<const std::byte> pay; std::uint32_t c = 0;
+        BOOST_TEST(decode_frame(std::span<const std::byte>(frames[k].data(), frames[k].size()), h, p, ps, pay, c));
+        BOOST_TEST(h.fec_gen_id == 10u + k % 3);
+        BOOST_TEST(h.seq_in_block == k / 3);
+    }
+
+    blocks.pop_back();
+    BOOST_TEST(!tx.assemble_interleaved(blocks, frames)); // needs exactly D blocks
+}
+
+BOOST_AUTO_TEST_CASE(v2_headers_carry_same_frames_in_fewer_bytes) {
+    struct Case { std::uint16_t N, K; bool varlen; };
+    const Case cases[] = { { 5, 1, false }, { 6, 3, true } };
+    for (const auto& c : cases) {
+        TxConfig v1cfg{ .N = c.N, .K = c.K, .max_payload_len = 1300 };
+        TxConfig v2cfg = v1cfg;
+        v2cfg.wire_version = k_protocol_version_v2;
+        TxBlockAssembler v1(v1cfg, 0x0001FFFFu), v2(v2cfg, 0x0001FFFFu), v2slab(v2cfg, 0x0001FFFFu), v2push(v2cfg, 0x0001FFFFu);
+
+        std::vector<std::vector<std::byte>> payloads(c.N);
+        for (std::uint16_t i = 0; i < c.N; ++i) {
+            payloads[i].resize(c.varlen ? 20u + i * 31u : 100u);
+            for (std::size_t k = 0; k < payloads[i].size(); ++k) payloads[i][k] = std::byte{ static_cast<unsigned char>(i * 7 + k) };
+        }
+        std::vector<std::span<const std::byte>> data;
+        for (const auto& p : payloads) data.emplace_back(p.data(), p.size());
+
+        std::vector<std::vector<std::byte>> f1, f2;
+        BOOST_TEST(v1.assemble_block(data, f1));
+        BOOST_TEST(v2.assemble_block(data, f2));
+        TxFrameSlab slab;
+        BOOST_TEST(v2slab.assemble_block(std::span<const std::span<const std::byte>>(data), slab));
+        BOOST_TEST(f2.size() == f1.size());
+        BOOST_TEST(slab.frame_count() == f2.size());
+
+        for (std::size_t f = 0; f < f1.size() && f < f2.size(); ++f) {
+            BOOST_TEST(f2[f].size() == f1[f].size() - 8u);
+            BaseHeader h1{}, h2{}; bool p1 = false, p2 = false; ParitySubheader s1{}, s2{};
+            std::span<const std::byte> pl1, pl2; std::uint32_t c1 = 0, c2 = 0;
+            BOOST_TEST(decode_frame(std::span<const std::byte>(f1[f].data(), f1[f].size()), h1, p1, s1, pl1, c1));
+            BOOST_TEST(decode_frame(std::span<const std::byte>(f2[f].data(), f2[f].size()), h2, p2, s2, pl2, c2));
+            BOOST_TEST(h2.version == k_protocol_version_v2);
+            BOOST_TEST(h2.fec_gen_id == 0xFFFFu);
+            BOOST_TEST(h2.flags1 == h1.flags1);
+            BOOST_TEST(h2.flags2 == h1.flags2);
+            BOOST_TEST(h2.seq_in_block == h1.seq_in_block);
+            BOOST_TEST(h2.data_count == h1.data_count);
+            BOOST_TEST(h2.parity_count == h1.parity_count);
+            BOOST_TEST(h2.payload_len == h1.payload_len);
+            BOOST_TEST(p2 == p1);
+            BOOST_TEST(s2.fec_scheme_id == s1.fec_scheme_id);
+            BOOST_TEST(s2.fec_parity_index == s1.fec_parity_index);
+            BOOST_TEST(c2 == c1);
+            BOOST_TEST((std::vector<std::byte>(pl2.begin(), pl2.end()) == std::vector<std::byte>(pl1.begin(), pl1.end())));
+            const auto got = slab.frame(f);
+            BOOST_TEST((std::vector<std::byte>(got.begin(), got.end()) == f2[f]));
+        }
+
+        // Gathered data frames: the short header is all that goes out
+        std::vector<std::byte> wire;
+        for (std::uint16_t i = 0; i < c.N; ++i) {
+            TxDataFrameParts parts;
+            std::vector<std::vector<std::byte>> parity;
+            BOOST_TEST(v2push.push_data(data[i], parts, parity));
+            BOOST_TEST(parts.header_len == 8u);
+            wire.assign(parts.header_bytes().begin(), parts.header_bytes().end());
+            wire.insert(wire.end(), data[i].begin(), data[i].end());
+            wire.insert(wire.end(), parts.trailer.begin(), parts.trailer.end());
+            BOOST_TEST((wire == f2[i]));
+        }
+    }
+
+    // Blocks the compact header cannot describe stay on v1
+    TxConfig big{ .N = 1100, .K = 1, .max_payload_len = 1300, .wire_version = k_protocol_version_v2 };
+    TxBlockAssembler tx(big, 7u);
+    const auto one = to_bytes("Z");
+    std::vector<std::span<const std::byte>> data(1100, std::span<const std::byte>(one.data(), one.size()));
+    std::vector<std::vector<std::byte>> frames;
+    BOOST_TEST(tx.assemble_block(data, frames));
+    BOOST_TEST(u8(frames[0][0]) == static_cast<unsigned>(k_protocol_version));
+}
+
+BOOST_AUTO_TEST_CASE(varlen_table_comes_out_of_the_width_budget) {
+    // N=100 at max_payload_len 1300: a varlen block may be 1300 - 200 = 1100 bytes wide.
+    TxConfig cfg{ .N = 100, .K = 1, .max_payload_len = 1300 };
+    TxBlockAssembler tx(cfg, /*gen_seed*/ 5u);
+    std::vector<std::vector<std::byte>> payloads(100, std::vector<std::byte>(10, std::byte{ 1 }));
+    auto spans = [&] { return std::vector<std::span<const std::byte>>(payloads.begin(), payloads.end()); };
+
+    std::vector<std::vector<std::byte>> frames;
+    payloads[7].resize(1100);
+    BOOST_TEST(tx.assemble_block(spans(), frames));
+    BOOST_TEST(frames.back().size() == encoded_size(1300, /*parity*/true));
+    const std::uint32_t gen = tx.peek_next_gen();
+    payloads[7].resize(1101);
+    BOOST_TEST(!tx.assemble_block(spans(), frames));
+    BOOST_TEST(tx.peek_next_gen() == gen);  // no generation id burned
+    TxFrameSlab slab;
+    BOOST_TEST(!tx.assemble_block(std::span<const std::span<const std::byte>>(spans()), slab));
+
+    // Equal lengths need no table and may use the full width.
+    for (auto& p : payloads) p.assign(1300, std::byte{ 2 });
+    BOOST_TEST(tx.assemble_block(spans(), frames));
+
+    // Incremental: payloads are held to the varlen width from the first push, so a short payload
+    // after a max-width one is still accepted and the block completes with its parity.
+    BOOST_TEST(tx.max_push_len() == 1100u);
+    std::vector<std::vector<std::byte>> out;
+    BOOST_TEST(!tx.push_data(payloads[0], out));
+    BOOST_TEST(out.empty());
+    BOOST_TEST(tx.pushed_in_block() == 0u);
+    const auto widest = std::span<const std::byte>(payloads[0].data(), 1100);
+    const std::vector<std::byte> short_one(10, std::byte{ 3 });
+    BOOST_TEST(tx.push_data(widest, out));
+    BOOST_TEST(tx.push_data(short_one, out));
+    BOOST_TEST(!tx.push_data(std::span<const std::byte>(payloads[0].data(), 1101), out));
+    for (std::uint16_t i = 2; i < 100; ++i) BOOST_TEST(tx.push_data(i % 2 ? std::span<const std::byte>(short_one) : widest, out));
+    BOOST_TEST(out.size() == 2u);  // last data frame + parity
+    BOOST_TEST(out[1].size() == encoded_size(1300, /*parity*/true));
+
+    // No room for a table at all (2N >= 1300): the first payload fixes the length of the rest.
+    TxBlockAssembler wide(TxConfig{ .N = 700, .K = 1, .max_payload_len = 1300 }, 6u);
+    BOOST_TEST(wide.max_push_len() == 1300u);
+    BOOST_TEST(wide.push_data(payloads[0], out));
+    BOOST_TEST(!wide.push_data(short_one, out));
+    BOOST_TEST(wide.push_data(payloads[1], out));
+}
+
+BOOST_AUTO_TEST_CASE(gf65536_odd_payloads_fit_the_parity_budget) {
+    // N > 256 selects GF(2^16): odd payloads are padded to even. Equal odd lengths carry the one
+    // common length; mixed lengths need all N, so their width is capped at 1300 - 2*300 = 700.
+    TxConfig cfg{ .N = 300, .K = 2, .max_payload_len = 1300 };
+    TxBlockAssembler tx(cfg, /*gen_seed*/ 9u);
+    std::vector<std::vector<std::byte>> payloads(300, std::vector<std::byte>(1297, std::byte{ 4 }));
+    std::vector<std::span<const std::byte>> spans(payloads.begin(), payloads.end());
+    std::vector<std::vector<std::byte>> frames;
+    BOOST_TEST(tx.assemble_block(spans, frames));
+    BOOST_TEST(frames.back().size() == encoded_size(1298 + 2, /*parity*/true));
+    BOOST_TEST(u8(frames.back()[1]) == static_cast<unsigned>(k_flags1_varlen | k_flags1_common_len));
+
+    payloads[0].resize(699);
+    spans.assign(payloads.begin(), payloads.end());
+    BOOST_TEST(!tx.assemble_block(spans, frames));
+    for (auto& p : payloads) p.resize(699);
+    payloads[0].resize(700);
+    spans.assign(payloads.begin(), payloads.end());
+    BOOST_TEST(tx.assemble_block(spans, frames));
+    BOOST_TEST(frames.back().size() == encoded_size(1300, /*parity*/true));
+    BOOST_TEST(u8(frames.back()[1]) == static_cast<unsigned>(k_flags1_varlen));
+
+    // Too many frames for a full table: equal odd payloads still stream, one length per parity frame.
+    TxBlockAssembler big(TxConfig{ .N = 1000, .K = 8, .max_payload_len = 1300 }, 10u);
+    const auto msg = to_bytes("hello world");
+    std::vector<std::vector<std::byte>> out;
+    for (int i = 0; i < 1000; ++i) BOOST_TEST(big.push_data(msg, out));
+    BOOST_TEST(out.size() == 9u);
+    BOOST_TEST(out[1].size() == encoded_size(12 + 2, /*parity*/true));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
\ No newline at end of file
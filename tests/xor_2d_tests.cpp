@@ -0,0 +1,140 @@
+#include <boost/test/unit_test.hpp>  // not the included runner
+#include <ltfec/fec_core/xor_2d.h>
+#include <ltfec/pipeline/tx_block_assembler.h>
+#include <ltfec/pipeline/rx_block_table.h>
+#include <ltfec/protocol/frame_builder.h>
+#include <ltfec/protocol/ids.h>
+#include "test_frames.h"
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+using namespace ltfec::fec_core;
+using namespace ltfec::pipeline;
+using namespace ltfec::protocol;
+
+namespace {
+    struct Block2d {
+        std::size_t N, K, L, len;
+        std::vector<std::vector<std::byte>> data, parity;
+        Block2d(std::size_t cols, std::size_t rows, std::size_t frame_len)
+            : N(cols * rows), K(cols + rows), L(cols), len(frame_len),
+            data(random_frames(N, frame_len, 31u)), parity(K, std::vector<std::byte>(frame_len))
+        {
+            std::vector<const std::byte*> d(N);
+            std::vector<std::byte*> p(K);
+            for (std::size_t i = 0; i < N; ++i) d[i] = data[i].data();
+            for (std::size_t j = 0; j < K; ++j) p[j] = parity[j].data();
+            xor2d_encode(std::span<const std::byte* const>(d), len, L, std::span<std::byte*>(p));
+        }
+
+        // Drop the listed data frames and try to get them back; returns #recovered (all verified).
+        std::size_t drop_and_recover(const std::vector<std::size_t>& lost, std::size_t& wrong) const {
+            std::vector<const std::byte*> d(N), p(K);
+            for (std::size_t i = 0; i < N; ++i) d[i] = data[i].data();
+            for (std::size_t j = 0; j < K; ++j) p[j] = parity[j].data();
+            for (auto i : lost) d[i] = nullptr;
+            std::vector<std::vector<std::byte>> out(N, std::vector<std::byte>(len));
+            std::vector<std::byte*> o(N);
+            for (std::size_t i = 0; i < N; ++i) o[i] = out[i].data();
+            const std::size_t n = xor2d_recover(std::span<const std::byte* const>(d), std::span<const std::byte* const>(p),
+                len, L, std::span<std::byte* const>(o));
+            wrong = 0;
+            if (n == lost.size()) for (auto i : lost) wrong += out[i] != data[i];
+            return n;
+        }
+    };
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(xor_2d_suite)
+
+BOOST_AUTO_TEST_CASE(supports_shape) {
+    BOOST_TEST(xor2d_supports(16, 8, 4));
+    BOOST_TEST(xor2d_supports(20, 9, 5));
+    BOOST_TEST(!xor2d_supports(16, 7, 4));  // K must be L + D
+    BOOST_TEST(!xor2d_supports(18, 9, 4));  // N not a multiple of L
+    BOOST_TEST(!xor2d_supports(16, 8, 0));
+}
+
+BOOST_AUTO_TEST_CASE(parity_lines_match_reference) {
+    const Block2d b(4, 3, 50);
+    for (std::size_t j = 0; j < b.K; ++j) {
+        std::vector<std::byte> ref(b.len);
+        for (std::size_t d = 0; d < b.N; ++d) {
+            if (!xor2d_in_line(j, d, b.L)) continue;
+            for (std::size_t k = 0; k < b.len; ++k) ref[k] ^= b.data[d][k];
+        }
+        BOOST_TEST((ref == b.parity[j]));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(recovers_any_burst_up_to_L) {
+    // Consecutive frames fall in distinct columns, so every burst of length <= L peels.
+    const Block2d b(5, 4, 64);
+    for (std::size_t burst = 1; burst <= b.L; ++burst) {
+        for (std::size_t start = 0; start + burst <= b.N; ++start) {
+            std::vector<std::size_t> lost;
+            for (std::size_t i = 0; i < burst; ++i) lost.push_back(start + i);
+            std::size_t wrong = 0;
+            BOOST_TEST(b.drop_and_recover(lost, wrong) == burst);
+            BOOST_TEST(wrong == 0u);
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(iterative_peeling_and_stopping_set) {
+    const Block2d b(4, 4, 32);
+    // Row 0 loses three frames, column 1 also loses frame 5: needs several peeling passes.
+    std::size_t wrong = 0;
+    BOOST_TEST(b.drop_and_recover({ 0, 1, 2, 5, 9 }, wrong) == 5u);
+    BOOST_TEST(wrong == 0u);
+
+    // A 2×2 square is a stopping set for row/column XOR.
+    BOOST_TEST(b.drop_and_recover({ 0, 1, 4, 5 }, wrong) == 0u);
+}
+
+BOOST_AUTO_TEST_CASE(rx_block_table_recovers_burst) {
+    // N = 4×4, K = 8; a burst of 4 data frames plus one lost row parity.
+    TxConfig cfg{ .N = 16, .K = 8, .max_payload_len = 1300,
+                  .fec_scheme_id = static_cast<std::uint8_t>(fec_scheme_id::xor_2d), .columns = 4 };
+    TxBlockAssembler tx(cfg, /*gen_seed*/ 4242u);
+    const auto payloads = random_frames(16, 300, 8u);
+    std::vector<std::span<const std::byte>> data;
+    for (const auto& p : payloads) data.emplace_back(p.data(), p.size());
+
+    std::vector<std::vector<std::byte>> frames;
+    BOOST_TEST(tx.assemble_block(data, frames));
+    const std::uint32_t gen = tx.peek_next_gen() - 1;
+
+    RxBlockTable rxt({ .reorder_ms = 50, .fps = 30, .max_payload_len = 1300 });
+    const std::uint64_t t0 = 100;
+    for (std::size_t i = 0; i < frames.size(); ++i) {
+        if ((i >= 6 && i <= 9) || i == 16 + 4 + 1) continue; // data 6..9, row-1 parity
+        BaseHeader h{}; bool hasp = false; ParitySubheader ps{}; std::span<const std::byte> pl; std::uint32_t crc = 0;
+        BOOST_TEST(decode_frame(std::span<const std::byte>(frames[i].data(), frames[i].size()), h, hasp, ps, pl, crc));
+        BOOST_TEST(flags2_get_columns(h.flags2) == 4u);
+        BOOST_TEST(rxt.ingest(t0, h, hasp, ps, pl));
+    }
+
+    RxClosedBlock closed{};
+    BOOST_TEST(rxt.close_if_ready(gen, t0 + 60, closed));
+    for (std::size_t i = 6; i <= 9; ++i) {
+        BOOST_TEST(closed.was_recovered[i]);
+        BOOST_TEST((closed.data[i] == payloads[i]));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(non_2d_blocks_keep_columns_zero) {
+    TxConfig cfg{ .N = 4, .K = 1, .max_payload_len = 1300, .fec_scheme_id = 0, .columns = 2 };
+    TxBlockAssembler tx(cfg, 1u);
+    const auto payloads = random_frames(4, 20, 9u);
+    std::vector<std::span<const std::byte>> data;
+    for (const auto& p : payloads) data.emplace_back(p.data(), p.size());
+    std::vector<std::vector<std::byte>> frames;
+    BOOST_TEST(tx.assemble_block(data, frames));
+    BaseHeader h{}; bool hasp = false; ParitySubheader ps{}; std::span<const std::byte> pl; std::uint32_t crc = 0;
+    BOOST_TEST(decode_frame(std::span<const std::byte>(frames[0].data(), frames[0].size()), h, hasp, ps, pl, crc));
+    BOOST_TEST(flags2_get_columns(h.flags2) == 0u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
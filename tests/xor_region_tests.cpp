@@ -0,0 +1,162 @@
+#include <boost/test/unit_test.hpp>  // not the included runner
+#include <ltfec/fec_core/xor_region.h>
+#include <ltfec/fec_core/xor_parity.h>
+#include <ltfec/util/crc32c.h>
+#include "test_env.h"
+#include "test_frames.h"
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#elif defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+using namespace ltfec::fec_core;
+using ltfec::util::SimdLevel;
+
+namespace {
+
+    std::vector<std::byte> naive_xor(const std::byte* seed, const std::vector<const std::byte*>& srcs, std::size_t L) {
+        std::vector<std::byte> out(L);
+        if (seed) std::copy_n(seed, L, out.begin());
+        for (auto* s : srcs) {
+            if (!s) continue;
+            for (std::size_t i = 0; i < L; ++i) out[i] ^= s[i];
+        }
+        return out;
+    }
+
+    // TSC ticks where available (≈ cycles on invariant-TSC CPUs), otherwise nanoseconds.
+    std::uint64_t ticks_now() {
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+        return __rdtsc();
+#else
+        using namespace std::chrono;
+        return static_cast<std::uint64_t>(duration_cast<nanoseconds>(steady_clock::now().time_since_epoch()).count());
+#endif
+    }
+
+} // namespace
+
+BOOST_AUTO_TEST_SUITE(xor_region_suite)
+
+BOOST_AUTO_TEST_CASE(matches_naive_all_levels_and_shapes) {
+    const std::size_t counts[] = { 0, 1, 2, 7, 8, 9, 17, 64 };
+    const std::size_t lens[] = { 1, 7, 8, 15, 16, 31, 32, 33, 100, 1300 };
+    const SimdLevel levels[] = { SimdLevel::scalar, SimdLevel::ssse3, SimdLevel::avx2 };
+
+    for (auto n : counts) {
+        for (auto L : lens) {
+            const auto frames = random_frames(n + 1, L, static_cast<std::uint32_t>(n * 131 + L));
+            std::vector<const std::byte*> srcs(n);
+            for (std::size_t i = 0; i < n; ++i) srcs[i] = (i % 5 == 3) ? nullptr : frames[i].data(); // sprinkle gaps
+            const std::byte* seed = frames[n].data();
+
+            const auto want_zero = naive_xor(nullptr, srcs, L);
+            const auto want_seed = naive_xor(seed, srcs, L);
+            for (auto lv : levels) {
+                std::vector<std::byte> out(L, std::byte{ 0xAA });
+                xor_regions(out.data(), nullptr, std::span<const std::byte* const>(srcs), L, lv);
+                BOOST_TEST(out == want_zero);
+
+                xor_regions(out.data(), seed, std::span<const std::byte* const>(srcs), L, lv);
+                BOOST_TEST(out == want_seed);
+
+                // Accumulate in place: dst = dst ^ srcs  (dst starts as the seed)
+                std::vector<std::byte> acc(seed, seed + L);
+                xor_regions(acc.data(), acc.data(), std::span<const std::byte* const>(srcs), L, lv);
+                BOOST_TEST(acc == want_seed);
+            }
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE(copy_xor_crc32c_matches_separate_passes) {
+    const std::size_t lens[] = { 0, 1, 7, 16, 33, 1300, 2048, 5000 };
+    for (auto L : lens) {
+        const auto frames = random_frames(2, L, static_cast<std::uint32_t>(L + 7));
+        const std::byte* src = frames[0].data();
+
+        std::vector<std::byte> want_acc = naive_xor(frames[1].data(), { src }, L);
+        const std::uint32_t want_crc = ltfec::util::crc32c(src, L);
+
+        std::vector<std::byte> dst(L, std::byte{ 0x55 });
+        std::vector<std::byte> acc(frames[1]);
+        const std::uint32_t crc = ltfec::util::crc32c_finish(
+            copy_xor_crc32c(dst.data(), acc.data(), src, L, ltfec::util::crc32c_init()));
+        BOOST_TEST(crc == want_crc);
+        BOOST_TEST(dst == frames[0]);
+        BOOST_TEST(acc == want_acc);
+
+        // No accumulator: copy + CRC only.
+        std::vector<std::byte> dst2(L);
+        BOOST_TEST(ltfec::util::crc32c_finish(copy_xor_crc32c(dst2.data(), nullptr, src, L,
+            ltfec::util::crc32c_init())) == want_crc);
+        BOOST_TEST(dst2 == frames[0]);
+    }
+}
+
+// Microbenchmark (opt-in): LTFEC_BENCH=1 tests.exe --run_test=xor_region_suite/bench_bytes_per_cycle
+// Reports output bytes per TSC tick for the engine at each tier vs. the former byte-wise loop.
+BOOST_AUTO_TEST_CASE(bench_bytes_per_cycle) {
+    if (!env_flag("LTFEC_BENCH")) {
+        BOOST_TEST_MESSAGE("skipped (set LTFEC_BENCH=1)");
+        return;
+    }
+
+    const std::size_t Ns[] = { 8, 16, 32, 64 };
+    const std::size_t Ls[] = { 64, 256, 1300, 9000 };
+    const std::size_t kTargetBytes = 64u << 20; // source bytes touched per measurement
+
+    std::cout << "\nxor_regions bytes/cycle (source bytes folded per tick)\n"
+        << std::setw(4) << "N" << std::setw(7) << "L"
+        << std::setw(10) << "bytewise" << std::setw(10) << "scalar"
+        << std::setw(10) << "ssse3" << std::setw(10) << "avx2" << "\n";
+
+    for (auto N : Ns) {
+        for (auto L : Ls) {
+            const auto frames = random_frames(N, L, static_cast<std::uint32_t>(N + L));
+            std::vector<const std::byte*> srcs(N);
+            for (std::size_t i = 0; i < N; ++i) srcs[i] = frames[i].data();
+            std::vector<std::byte> out(L);
+            const std::size_t iters = std::max<std::size_t>(1, kTargetBytes / (N * L));
+
+            auto measure = [&](auto&& body) {
+                body(); // warm-up
+                const auto t0 = ticks_now();
+                for (std::size_t it = 0; it < iters; ++it) body();
+                const auto t1 = ticks_now();
+                return static_cast<double>(N * L * iters) / static_cast<double>(t1 > t0 ? t1 - t0 : 1);
+            };
+
+            const double bytewise = measure([&] {
+                std::fill(out.begin(), out.end(), std::byte{ 0 });
+                for (auto* s : srcs) for (std::size_t i = 0; i < L; ++i) out[i] ^= s[i];
+            });
+            double tier[3]{};
+            const SimdLevel levels[] = { SimdLevel::scalar, SimdLevel::ssse3, SimdLevel::avx2 };
+            for (int t = 0; t < 3; ++t) {
+                tier[t] = measure([&] {
+                    xor_regions(out.data(), nullptr, std::span<const std::byte* const>(srcs), L, levels[t]);
+                });
+            }
+
+            std::cout << std::setw(4) << N << std::setw(7) << L << std::fixed << std::setprecision(2)
+                << std::setw(10) << bytewise << std::setw(10) << tier[0]
+                << std::setw(10) << tier[1] << std::setw(10) << tier[2] << "\n";
+        }
+    }
+    std::cout << "(tiers above the CPU's best level fall back to it: " << static_cast<int>(ltfec::util::best_simd_level()) << ")\n";
+    BOOST_TEST(true);
+}
+
+BOOST_AUTO_TEST_SUITE_END()